@@ -0,0 +1,132 @@
+// Mide cuánto tarda AllPairsShortestPaths, el Floyd-Warshall por bloques, con 1 a varios hilos y con o sin
+// el siguiente nodo de cada camino, frente a un Floyd-Warshall de tres ciclos sobre la misma matriz.
+// Compilar desde la raíz del repositorio (con -mavx2 se usa el núcleo vectorial):
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/allpairs_floyd.cpp -o allpairs_floyd
+// Uso: ./allpairs_floyd [nodos] [porcentaje de aristas] [máximo de hilos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <cstdint>
+#include <chrono>
+using namespace std;
+
+#include "allpairs.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 1500;
+    int percent = argc > 2 ? atoi(argv[2]) : 10;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : 8;
+    totalNodes = totalNodes > 0 ? totalNodes : 1;
+    percent = percent > 0 ? percent : 1;
+    maxThreads = maxThreads > 0 ? maxThreads : 1;
+
+    // Matriz de pesos indexada desde 1, con INT32_MAX / 2 para los pares sin arista.
+    int size = totalNodes + 1;
+    int *weights = new int[(size_t)size * size];
+    for (size_t i = 0; i < (size_t)size * size; i++)
+    {
+        weights[i] = INT32_MAX / 2;
+    }
+    for (int i = 0; i < size; i++)
+    {
+        weights[(size_t)i * size + i] = 0;
+    }
+    unsigned seed = 12345;
+    long long edges = 0;
+    for (int u = 1; u <= totalNodes; u++)
+    {
+        for (int v = 1; v <= totalNodes; v++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            if (u != v && (int)((seed >> 8) % 100) < percent)
+            {
+                weights[(size_t)u * size + v] = 1 + (int)(seed % 1000);
+                edges++;
+            }
+        }
+    }
+    cout << totalNodes << " nodos, " << edges << " aristas dirigidas, " << ThreadPool::hardwareThreads() << " núcleos"
+         << endl;
+
+    // El de tres ciclos resuelve una copia, que da las distancias de referencia.
+    double operations = (double)totalNodes * totalNodes * totalNodes;
+    int *solved = new int[(size_t)size * size];
+    for (size_t i = 0; i < (size_t)size * size; i++)
+    {
+        solved[i] = weights[i];
+    }
+    double naiveSeconds = measure([&]()
+    {
+        for (int k = 1; k <= totalNodes; k++)
+        {
+            const int *rowK = solved + (size_t)k * size;
+            for (int i = 1; i <= totalNodes; i++)
+            {
+                int *rowI = solved + (size_t)i * size;
+                int left = rowI[k];
+                for (int j = 1; j <= totalNodes; j++)
+                {
+                    int sum = left + rowK[j];
+                    rowI[j] = sum < rowI[j] ? sum : rowI[j];
+                }
+            }
+        }
+    });
+    cout << "Floyd-Warshall de tres ciclos: " << naiveSeconds * 1e3 << " ms, "
+         << operations / naiveSeconds / 1e9 << " G operaciones min-plus/s" << endl;
+
+    for (int withNextHops = 0; withNextHops < 2; withNextHops++)
+    {
+        for (int threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            AllPairsShortestPaths paths(totalNodes, withNextHops == 1);
+            for (int u = 1; u <= totalNodes; u++)
+            {
+                for (int v = 1; v <= totalNodes; v++)
+                {
+                    if (u != v && weights[(size_t)u * size + v] < INT32_MAX / 2)
+                    {
+                        paths.addEdge(u, v, weights[(size_t)u * size + v]);
+                    }
+                }
+            }
+            double seconds = measure([&]() { paths.solve(threads); });
+            cout << (withNextHops == 1 ? "Con" : "Sin") << " siguiente nodo, " << threads << " hilos: "
+                 << seconds * 1e3 << " ms, " << operations / seconds / 1e9 << " G operaciones min-plus/s" << endl;
+            if (withNextHops == 1 && threads == 1)
+            {
+                Stack<int> *path = paths.path(1, totalNodes);
+                int length = 0;
+                while (!path->isEmpty())
+                {
+                    path->pop();
+                    length++;
+                }
+                delete path;
+                cout << "  Camino de 1 a " << totalNodes << ": " << length << " nodos" << endl;
+            }
+            for (int u = 1; u <= totalNodes; u++)
+            {
+                for (int v = 1; v <= totalNodes; v++)
+                {
+                    int expected = solved[(size_t)u * size + v];
+                    assert(paths.distance(u, v) == (expected >= INT32_MAX / 2 ? INT32_MAX : expected));
+                }
+            }
+        }
+    }
+
+    delete[] weights;
+    delete[] solved;
+    return 0;
+}
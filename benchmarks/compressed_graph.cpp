@@ -0,0 +1,168 @@
+// Mide CompressedGraph frente a CSRGraph en una grilla con dos aristas aleatorias más por nodo: cuánto tarda
+// en construirse desde el CSR y con un Builder, cuántos bytes ocupa por arista, y cuánto tardan un recorrido en
+// anchura, dijkstra y toCSR. También comprime el grafo renumerado con REVERSE_CUTHILL_MCKEE.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/compressed_graph.cpp -o compressed_graph
+// Uso: ./compressed_graph [lado de la grilla] [consultas de dijkstra] [máximo de hilos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "compressedgraph.h"
+#include "reorder.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Retorna la cantidad de bytes que ocupan los arreglos del grafo CSR.
+size_t csrMemory(const CSRGraph &graph)
+{
+    return (size_t)(graph.totalNodes() + 2) * sizeof(int) + (size_t)graph.totalEdges() * 2 * sizeof(int);
+}
+
+/// @brief Retorna la cantidad de nodos del camino y libera el stack.
+int pathLength(Stack<int> *path)
+{
+    int length = 0;
+    while (!path->isEmpty())
+    {
+        path->pop();
+        length++;
+    }
+    delete path;
+    return length;
+}
+
+int main(int argc, char **argv)
+{
+    int side = argc > 1 ? atoi(argv[1]) : 1000;
+    int queries = argc > 2 ? atoi(argv[2]) : 10;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : 8;
+    side = side > 1 ? side : 2;
+    queries = queries > 0 ? queries : 1;
+    maxThreads = maxThreads > 0 ? maxThreads : 1;
+
+    // Grilla no dirigida más dos aristas aleatorias por nodo, con pesos de 1 a 100.
+    int totalNodes = side * side;
+    int maxEdges = 4 * side * (side - 1) + 4 * totalNodes;
+    int *from = new int[maxEdges];
+    int *to = new int[maxEdges];
+    int *weights = new int[maxEdges];
+    unsigned seed = 12345;
+    int totalEdges = 0;
+    for (int node = 1; node <= totalNodes; node++)
+    {
+        int r = (node - 1) / side;
+        int c = (node - 1) % side;
+        int neighbors[4] = {c + 1 < side ? node + 1 : 0, r + 1 < side ? node + side : 0, 0, 0};
+        for (int k = 2; k < 4; k++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            neighbors[k] = 1 + (int)((seed >> 4) % totalNodes);
+        }
+        for (int k = 0; k < 4; k++)
+        {
+            if (neighbors[k] != 0)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                from[totalEdges] = to[totalEdges + 1] = node;
+                to[totalEdges] = from[totalEdges + 1] = neighbors[k];
+                weights[totalEdges] = weights[totalEdges + 1] = 1 + (int)((seed >> 8) % 100);
+                totalEdges += 2;
+            }
+        }
+    }
+    CSRGraph csr(totalNodes, totalEdges, from, to, weights, false);
+    delete[] from;
+    delete[] to;
+    delete[] weights;
+    cout << totalNodes << " nodos, " << totalEdges << " aristas" << endl;
+    cout << "CSRGraph: " << (double)csrMemory(csr) / totalEdges << " bytes por arista" << endl;
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        CompressedGraph *compressed = NULL;
+        double seconds = measure([&]() { compressed = new CompressedGraph(csr, threads); });
+        cout << "Construcción desde el CSR con " << threads << " hilos: " << seconds * 1e3 << " ms" << endl;
+        delete compressed;
+    }
+
+    // El Builder recibe las aristas agrupadas por origen, como las del CSR.
+    CompressedGraph *built = NULL;
+    double builderSeconds = measure([&]()
+    {
+        CompressedGraph::Builder builder(false);
+        for (int u = 1; u <= totalNodes; u++)
+        {
+            for (int e = csr.edgesBegin(u); e < csr.edgesEnd(u); e++)
+            {
+                builder.addEdge(u, csr.target(e), csr.weight(e));
+            }
+        }
+        built = builder.build(totalNodes);
+    });
+    assert(built != NULL && built->isValid() && built->totalEdges() == totalEdges);
+    cout << "Construcción con Builder: " << builderSeconds * 1e3 << " ms" << endl;
+    cout << "CompressedGraph: " << (double)built->memoryUsage() / totalEdges << " bytes por arista, "
+         << (double)built->totalBytes() / totalEdges << " de adyacentes" << endl;
+
+    long long csrVisited = 0;
+    long long compressedVisited = 0;
+    double csrBfsSeconds = measure([&]() { csr.bfSearch(1, [&](int, int) { csrVisited++; }); });
+    double compressedBfsSeconds = measure([&]() { built->bfSearch(1, [&](int, int) { compressedVisited++; }); });
+    assert(csrVisited == compressedVisited);
+    cout << "Recorrido en anchura: CSR " << csrBfsSeconds * 1e3 << " ms, comprimido " << compressedBfsSeconds * 1e3
+         << " ms" << endl;
+
+    long long csrLength = 0;
+    long long compressedLength = 0;
+    double csrDijkstraSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            csrLength += pathLength(csr.dijkstra(1 + q, totalNodes - q));
+        }
+    });
+    double compressedDijkstraSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            compressedLength += pathLength(built->dijkstra(1 + q, totalNodes - q));
+        }
+    });
+    assert(csrLength > 0 && compressedLength > 0);
+    cout << "dijkstra: CSR " << csrDijkstraSeconds / queries * 1e3 << " ms, comprimido "
+         << compressedDijkstraSeconds / queries * 1e3 << " ms por consulta" << endl;
+
+    CSRGraph *expanded = NULL;
+    double expandSeconds = measure([&]() { expanded = built->toCSR(); });
+    assert(expanded->totalEdges() == totalEdges);
+    cout << "toCSR: " << expandSeconds * 1e3 << " ms" << endl;
+    delete expanded;
+
+    Reordering *reordering = Reordering::compute(csr, REVERSE_CUTHILL_MCKEE);
+    CSRGraph *reordered = reordering->apply(csr);
+    CompressedGraph *compressedReordered = new CompressedGraph(*reordered);
+    long long reorderedVisited = 0;
+    double reorderedBfsSeconds = measure([&]()
+    {
+        compressedReordered->bfSearch(reordering->newId(1), [&](int, int) { reorderedVisited++; });
+    });
+    assert(reorderedVisited == csrVisited);
+    cout << "Renumerado con REVERSE_CUTHILL_MCKEE: " << (double)compressedReordered->totalBytes() / totalEdges
+         << " bytes de adyacentes por arista, recorrido en anchura " << reorderedBfsSeconds * 1e3 << " ms" << endl;
+
+    delete compressedReordered;
+    delete reordered;
+    delete reordering;
+    delete built;
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Mide el recorrido en profundidad iterativo de Graph sobre un camino largo, que antes desbordaba la pila de
+// llamadas, y cuánto tardan las componentes fuertemente conexas (Tarjan) y débilmente conexas (Afforest,
+// con 1 a varios hilos) sobre un CSRGraph aleatorio, frente a unir todas las aristas con UnionFind.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/connected_components.cpp -o connected_components
+// Uso: ./connected_components [nodos] [aristas cada 10 nodos] [máximo de hilos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "graph.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int density = argc > 2 ? atoi(argv[2]) : 15;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : 8;
+    totalNodes = totalNodes > 1 ? totalNodes : 2;
+    density = density > 0 ? density : 1;
+    maxThreads = maxThreads > 0 ? maxThreads : 1;
+    cout << totalNodes << " nodos, " << ThreadPool::hardwareThreads() << " núcleos" << endl;
+
+    // Camino dirigido 1, 2, ..., totalNodes: la profundidad del recorrido es la cantidad de nodos.
+    {
+        Graph path(totalNodes, true, false, false);
+        for (int node = 1; node < totalNodes; node++)
+        {
+            path.addEdge(node, node + 1);
+        }
+        long long visited = 0;
+        double seconds = measure([&]() { path.dfSearch(1, [&](int) { visited++; }); });
+        assert(visited == totalNodes);
+        cout << "dfSearch sobre un camino de " << totalNodes << " nodos: " << seconds * 1e3 << " ms" << endl;
+    }
+
+    // Con pocas aristas por nodo quedan muchas componentes de distintos tamaños.
+    int totalEdges = (int)((long long)totalNodes * density / 10);
+    int *from = new int[totalEdges > 0 ? totalEdges : 1];
+    int *to = new int[totalEdges > 0 ? totalEdges : 1];
+    unsigned seed = 12345;
+    for (int i = 0; i < totalEdges; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        from[i] = 1 + (int)((seed >> 4) % totalNodes);
+        seed = seed * 1664525u + 1013904223u;
+        to[i] = 1 + (int)((seed >> 4) % totalNodes);
+    }
+    CSRGraph directed(totalNodes, totalEdges, from, to, NULL, true);
+    // El grafo no dirigido necesita cada arista en ambos sentidos.
+    int *bothFrom = new int[2 * (size_t)totalEdges + 1];
+    int *bothTo = new int[2 * (size_t)totalEdges + 1];
+    for (int i = 0; i < totalEdges; i++)
+    {
+        bothFrom[2 * i] = bothTo[2 * i + 1] = from[i];
+        bothTo[2 * i] = bothFrom[2 * i + 1] = to[i];
+    }
+    CSRGraph undirected(totalNodes, 2 * totalEdges, bothFrom, bothTo, NULL, false);
+    delete[] bothFrom;
+    delete[] bothTo;
+    cout << totalEdges << " aristas aleatorias" << endl;
+
+    int *component = new int[totalNodes + 1];
+    int strong = 0;
+    double strongSeconds = measure([&]() { strong = ConnectedComponents::strong(directed, component); });
+    for (int u = 1; u <= totalNodes; u++)
+    {
+        for (int e = directed.edgesBegin(u); e < directed.edgesEnd(u); e++)
+        {
+            assert(component[u] >= component[directed.target(e)]);
+        }
+    }
+    cout << "Componentes fuertes: " << strong << ", " << strongSeconds * 1e3 << " ms" << endl;
+
+    UnionFind sets(totalNodes);
+    double unionSeconds = measure([&]()
+    {
+        for (int i = 0; i < totalEdges; i++)
+        {
+            sets.unite(from[i], to[i]);
+        }
+    });
+    cout << "Componentes débiles con UnionFind: " << sets.sets() << ", " << unionSeconds * 1e3 << " ms" << endl;
+
+    for (int d = 0; d < 2; d++)
+    {
+        const CSRGraph &graph = d == 0 ? undirected : directed;
+        for (int threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            int weak = 0;
+            double seconds = measure([&]() { weak = ConnectedComponents::weak(graph, component, threads); });
+            assert(weak == sets.sets());
+            for (int i = 0; i < totalEdges; i++)
+            {
+                assert(component[from[i]] == component[to[i]]);
+            }
+            cout << "Componentes débiles del grafo " << (d == 0 ? "no dirigido" : "dirigido") << " con " << threads
+                 << " hilos: " << seconds * 1e3 << " ms" << endl;
+        }
+    }
+
+    delete[] component;
+    delete[] from;
+    delete[] to;
+    return 0;
+}
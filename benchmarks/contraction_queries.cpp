@@ -0,0 +1,161 @@
+// Mide una ContractionHierarchy sobre una grilla con pesos aleatorios: cuánto tarda en construirse, cuánto
+// tardan distance y shortestPath frente a CSRGraph::dijkstra, cuántos nodos asienta cada consulta, y cuánto
+// tarda en guardarse y cargarse.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/contraction_queries.cpp -o contraction_queries
+// Uso: ./contraction_queries [lado de la grilla] [consultas] [archivo temporal]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+using namespace std;
+
+#include "contraction.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Retorna el costo del camino, usando la arista más liviana entre cada par de nodos, y libera el stack.
+long long pathCost(const CSRGraph &graph, Stack<int> *path)
+{
+    long long cost = 0;
+    int node = path->peek();
+    path->pop();
+    while (!path->isEmpty())
+    {
+        int lightest = INT32_MAX;
+        for (int e = graph.edgesBegin(node); e < graph.edgesEnd(node); e++)
+        {
+            if (graph.target(e) == path->peek() && graph.weight(e) < lightest)
+            {
+                lightest = graph.weight(e);
+            }
+        }
+        assert(lightest != INT32_MAX);
+        cost += lightest;
+        node = path->peek();
+        path->pop();
+    }
+    delete path;
+    return cost;
+}
+
+int main(int argc, char **argv)
+{
+    int side = argc > 1 ? atoi(argv[1]) : 256;
+    int queries = argc > 2 ? atoi(argv[2]) : 200;
+    const char *fileName = argc > 3 ? argv[3] : "contraction_queries.bin";
+    side = side > 1 ? side : 2;
+    queries = queries > 0 ? queries : 1;
+
+    // El nodo de la fila r y la columna c es r * side + c + 1, unido a sus vecinos de la derecha y de abajo
+    // en ambos sentidos con pesos de 1 a 100 distintos para cada sentido.
+    int totalNodes = side * side;
+    int totalEdges = 4 * side * (side - 1);
+    int *from = new int[totalEdges];
+    int *to = new int[totalEdges];
+    int *weights = new int[totalEdges];
+    unsigned seed = 12345;
+    int edges = 0;
+    for (int r = 0; r < side; r++)
+    {
+        for (int c = 0; c < side; c++)
+        {
+            int node = r * side + c + 1;
+            for (int d = 0; d < 2; d++)
+            {
+                int neighbor = d == 0 ? node + 1 : node + side;
+                if (d == 0 ? c + 1 < side : r + 1 < side)
+                {
+                    for (int k = 0; k < 2; k++)
+                    {
+                        seed = seed * 1664525u + 1013904223u;
+                        from[edges] = k == 0 ? node : neighbor;
+                        to[edges] = k == 0 ? neighbor : node;
+                        weights[edges] = 1 + (int)((seed >> 8) % 100);
+                        edges++;
+                    }
+                }
+            }
+        }
+    }
+    assert(edges == totalEdges);
+    CSRGraph graph(totalNodes, totalEdges, from, to, weights, true);
+    delete[] from;
+    delete[] to;
+    delete[] weights;
+
+    ContractionHierarchy *hierarchy = NULL;
+    double buildSeconds = measure([&]() { hierarchy = new ContractionHierarchy(graph); });
+
+    int *sources = new int[queries];
+    int *targets = new int[queries];
+    for (int q = 0; q < queries; q++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        sources[q] = 1 + (int)((seed >> 4) % totalNodes);
+        seed = seed * 1664525u + 1013904223u;
+        targets[q] = 1 + (int)((seed >> 4) % totalNodes);
+    }
+
+    long long distanceSum = 0;
+    long long settled = 0;
+    double distanceSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            distanceSum += hierarchy->distance(sources[q], targets[q]);
+            settled += hierarchy->settledNodes();
+        }
+    });
+    long long pathSum = 0;
+    double pathSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            pathSum += pathCost(graph, hierarchy->shortestPath(sources[q], targets[q]));
+        }
+    });
+    long long dijkstraSum = 0;
+    double dijkstraSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            dijkstraSum += pathCost(graph, graph.dijkstra(sources[q], targets[q]));
+        }
+    });
+    assert(distanceSum == pathSum && distanceSum == dijkstraSum);
+
+    bool saved = false;
+    double saveSeconds = measure([&]() { saved = hierarchy->save(fileName); });
+    assert(saved);
+    ContractionHierarchy *loaded = NULL;
+    double loadSeconds = measure([&]() { loaded = ContractionHierarchy::load(fileName); });
+    assert(loaded != NULL && loaded->totalArcs() == hierarchy->totalArcs());
+    for (int q = 0; q < queries; q++)
+    {
+        assert(loaded->distance(sources[q], targets[q]) == hierarchy->distance(sources[q], targets[q]));
+    }
+    remove(fileName);
+
+    cout << side << " x " << side << " nodos, " << totalEdges << " aristas, " << queries << " consultas" << endl;
+    cout << "Construcción: " << buildSeconds * 1e3 << " ms, " << hierarchy->totalArcs() << " aristas con atajos" << endl;
+    cout << "distance: " << distanceSeconds / queries * 1e6 << " us por consulta, "
+         << (double)settled / queries << " nodos asentados en promedio" << endl;
+    cout << "shortestPath: " << pathSeconds / queries * 1e6 << " us por consulta" << endl;
+    cout << "CSRGraph::dijkstra: " << dijkstraSeconds / queries * 1e6 << " us por consulta" << endl;
+    cout << "save: " << saveSeconds * 1e3 << " ms, load: " << loadSeconds * 1e3 << " ms" << endl;
+
+    delete hierarchy;
+    delete loaded;
+    delete[] sources;
+    delete[] targets;
+    return 0;
+}
@@ -0,0 +1,100 @@
+// Mide cuánto tarda en construirse un CSRGraph a partir de un arreglo de aristas con 1 a varios hilos, en un
+// grafo disperso (menos aristas que nodos) y en uno con varias aristas por nodo, y cuánto tarda un recorrido
+// en anchura sobre el CSR frente al mismo recorrido sobre las listas de adyacencia de Graph.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/csr_build.cpp -o csr_build
+// Uso: ./csr_build [nodos] [máximo de hilos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "graph.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Llena from, to y weights con totalEdges aristas dirigidas aleatorias entre nodos de 1 a totalNodes.
+void randomEdges(int totalNodes, int totalEdges, int *from, int *to, int *weights)
+{
+    unsigned seed = 12345;
+    for (int i = 0; i < totalEdges; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        from[i] = 1 + (int)((seed >> 4) % totalNodes);
+        seed = seed * 1664525u + 1013904223u;
+        to[i] = 1 + (int)((seed >> 4) % totalNodes);
+        weights[i] = 1 + (int)(seed % 100);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : 8;
+    totalNodes = totalNodes > 0 ? totalNodes : 1;
+    maxThreads = maxThreads > 0 ? maxThreads : 1;
+
+    cout << totalNodes << " nodos, " << ThreadPool::hardwareThreads() << " núcleos" << endl;
+    int degrees[] = {0, 8};
+    for (int d = 0; d < 2; d++)
+    {
+        // Con grado 0 se usa media arista por nodo.
+        int totalEdges = degrees[d] > 0 ? totalNodes * degrees[d] : totalNodes / 2;
+        int *from = new int[totalEdges > 0 ? totalEdges : 1];
+        int *to = new int[totalEdges > 0 ? totalEdges : 1];
+        int *weights = new int[totalEdges > 0 ? totalEdges : 1];
+        randomEdges(totalNodes, totalEdges, from, to, weights);
+        cout << totalEdges << " aristas:" << endl;
+
+        CSRGraph *reference = NULL;
+        for (int threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            CSRGraph *csr = NULL;
+            double seconds = measure([&]() { csr = new CSRGraph(totalNodes, totalEdges, from, to, weights, true, threads); });
+            if (reference == NULL)
+            {
+                reference = csr;
+            }
+            else
+            {
+                for (int u = 1; u <= totalNodes + 1; u++)
+                {
+                    assert(csr->offsets()[u] == reference->offsets()[u]);
+                }
+                for (int e = 0; e < totalEdges; e++)
+                {
+                    assert(csr->target(e) == reference->target(e) && csr->weight(e) == reference->weight(e));
+                }
+                delete csr;
+            }
+            cout << "  Construcción con " << threads << " hilos: " << seconds * 1e3 << " ms" << endl;
+        }
+
+        Graph graph(totalNodes, true, true, false);
+        for (int i = 0; i < totalEdges; i++)
+        {
+            graph.addEdge(from[i], to[i], weights[i]);
+        }
+        long long csrVisited = 0;
+        long long listVisited = 0;
+        double csrSeconds = measure([&]() { reference->bfSearch(1, [&](int, int) { csrVisited++; }); });
+        double listSeconds = measure([&]() { graph.bfSearch(1, [&](int, int) { listVisited++; }); });
+        assert(csrVisited == listVisited);
+        cout << "  Recorrido en anchura de " << csrVisited << " nodos: CSR " << csrSeconds * 1e3
+             << " ms, listas de adyacencia " << listSeconds * 1e3 << " ms" << endl;
+
+        delete reference;
+        delete[] from;
+        delete[] to;
+        delete[] weights;
+    }
+    return 0;
+}
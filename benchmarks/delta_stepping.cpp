@@ -0,0 +1,98 @@
+// Mide cuánto tarda DeltaStepping en calcular los caminos más cortos desde un origen con distintos anchos de
+// balde y de 1 a varios hilos, frente a CSRGraph::dijkstra hasta el nodo más lejano, que asienta casi todos.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/delta_stepping.cpp -o delta_stepping
+// Uso: ./delta_stepping [nodos] [aristas por nodo] [mayor peso] [máximo de hilos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "deltastepping.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int degree = argc > 2 ? atoi(argv[2]) : 8;
+    int maxWeight = argc > 3 ? atoi(argv[3]) : 1000;
+    int maxThreads = argc > 4 ? atoi(argv[4]) : 8;
+    totalNodes = totalNodes > 0 ? totalNodes : 1;
+    degree = degree > 0 ? degree : 1;
+    maxWeight = maxWeight > 0 ? maxWeight : 1;
+    maxThreads = maxThreads > 0 ? maxThreads : 1;
+
+    int totalEdges = totalNodes * degree;
+    int *from = new int[totalEdges];
+    int *to = new int[totalEdges];
+    int *weights = new int[totalEdges];
+    unsigned seed = 12345;
+    for (int i = 0; i < totalEdges; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        from[i] = 1 + (int)((seed >> 4) % totalNodes);
+        seed = seed * 1664525u + 1013904223u;
+        to[i] = 1 + (int)((seed >> 4) % totalNodes);
+        weights[i] = 1 + (int)((seed >> 8) % maxWeight);
+    }
+    CSRGraph graph(totalNodes, totalEdges, from, to, weights, true, maxThreads);
+    delete[] from;
+    delete[] to;
+    delete[] weights;
+
+    int *distances = new int[totalNodes + 1];
+    int *predecessors = new int[totalNodes + 1];
+    int *expected = new int[totalNodes + 1];
+    cout << totalNodes << " nodos, " << totalEdges << " aristas, pesos entre 1 y " << maxWeight << ", "
+         << ThreadPool::hardwareThreads() << " núcleos" << endl;
+
+    // El primer ancho es el automático, que además da las distancias de referencia.
+    int deltas[] = {0, 1, maxWeight};
+    bool hasExpected = false;
+    for (int d = 0; d < 3; d++)
+    {
+        for (int threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            DeltaStepping search(graph, deltas[d], threads);
+            double seconds = measure([&]() { search.search(1, distances, predecessors); });
+            for (int u = 1; u <= totalNodes; u++)
+            {
+                if (!hasExpected)
+                {
+                    expected[u] = distances[u];
+                }
+                assert(distances[u] == expected[u]);
+            }
+            hasExpected = true;
+            cout << "delta = " << search.delta() << ", " << threads << " hilos: " << seconds * 1e3 << " ms" << endl;
+        }
+    }
+
+    int farthest = 1;
+    for (int u = 1; u <= totalNodes; u++)
+    {
+        if (expected[u] != INT32_MAX && expected[u] > expected[farthest])
+        {
+            farthest = u;
+        }
+    }
+    Stack<int> *path = NULL;
+    double dijkstraSeconds = measure([&]() { path = graph.dijkstra(1, farthest); });
+    assert(!path->isEmpty());
+    cout << "CSRGraph::dijkstra hasta el nodo más lejano: " << dijkstraSeconds * 1e3 << " ms" << endl;
+
+    delete path;
+    delete[] distances;
+    delete[] predecessors;
+    delete[] expected;
+    return 0;
+}
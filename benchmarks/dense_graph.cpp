@@ -0,0 +1,91 @@
+// Mide el modo denso de Graph, que guarda los pesos en una matriz contigua y las aristas en un bitset:
+// cuánto tarda en cargarse, en consultar pesos al azar, y en recorrer el grafo con bfSearch, dijkstra y prim.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -Iheaders benchmarks/dense_graph.cpp -o dense_graph
+// Uso: ./dense_graph [nodos] [porcentaje de aristas] [consultas de peso]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+#include <sys/resource.h>
+using namespace std;
+
+#include "graph.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 4000;
+    int percent = argc > 2 ? atoi(argv[2]) : 25;
+    int queries = argc > 3 ? atoi(argv[3]) : 1 << 22;
+    totalNodes = totalNodes > 1 ? totalNodes : 2;
+    percent = percent > 0 ? percent : 1;
+
+    // Grafo no dirigido con un camino 1, 2, ..., totalNodes para que sea conexo, y cada par de nodos
+    // unido con la probabilidad dada.
+    Graph graph(totalNodes, false, true, true);
+    long long edges = 0;
+    double loadSeconds = measure([&]()
+    {
+        unsigned seed = 12345;
+        for (int u = 1; u <= totalNodes; u++)
+        {
+            for (int v = u + 1; v <= totalNodes; v++)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                if (v == u + 1 || (int)((seed >> 8) % 100) < percent)
+                {
+                    graph.addEdge(u, v, 1 + (int)(seed % 1000));
+                    edges++;
+                }
+            }
+        }
+    });
+
+    long long weightSum = 0;
+    double lookupSeconds = measure([&]()
+    {
+        unsigned seed = 6789;
+        for (int q = 0; q < queries; q++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            int from = 1 + (int)((seed >> 4) % totalNodes);
+            seed = seed * 1664525u + 1013904223u;
+            int to = 1 + (int)((seed >> 4) % totalNodes);
+            // Las aristas que no existen tienen un peso negativo.
+            int weight = graph.edgeWeight(from, to);
+            weightSum += weight > 0 ? weight : 0;
+        }
+    });
+
+    long long visited = 0;
+    double bfsSeconds = measure([&]() { graph.bfSearch(1, [&](int, int) { visited++; }); });
+    assert(visited == totalNodes);
+
+    Stack<int> *path = NULL;
+    double dijkstraSeconds = measure([&]() { path = graph.dijkstra(1, totalNodes); });
+    assert(!path->isEmpty());
+    delete path;
+
+    int *cost = NULL;
+    double primSeconds = measure([&]() { cost = graph.prim(1); });
+    assert(cost != NULL);
+    delete cost;
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    cout << totalNodes << " nodos, " << edges << " aristas no dirigidas" << endl;
+    cout << "Carga: " << loadSeconds * 1e3 << " ms, memoria máxima del proceso " << usage.ru_maxrss / 1024 << " MB" << endl;
+    cout << "Consultas de peso: " << queries / lookupSeconds / 1e6 << " M/s (suma " << weightSum << ")" << endl;
+    cout << "bfSearch: " << bfsSeconds * 1e3 << " ms, dijkstra: " << dijkstraSeconds * 1e3 << " ms, prim: "
+         << primSeconds * 1e3 << " ms" << endl;
+    return 0;
+}
@@ -0,0 +1,104 @@
+// Mide cuánto tardan Graph::dijkstra y Graph::prim con la cola de prioridad indexada (BINARY_HEAP), en un
+// grafo aleatorio guardado con listas de adyacencia y en uno denso guardado en una matriz.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -Iheaders benchmarks/dijkstra_prim.cpp -o dijkstra_prim
+// Uso: ./dijkstra_prim [nodos] [aristas por nodo] [consultas] [nodos del grafo denso]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "graph.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Crea un grafo no dirigido con un camino 1, 2, ..., totalNodes, para que sea conexo,
+/// y degree aristas aleatorias más por nodo, de pesos entre 1 y 1000.
+Graph *randomGraph(int totalNodes, int degree, bool isDense)
+{
+    Graph *graph = new Graph(totalNodes, false, true, isDense);
+    unsigned seed = 12345;
+    for (int node = 1; node < totalNodes; node++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        graph->addEdge(node, node + 1, 1 + (int)(seed >> 8) % 1000);
+    }
+    for (int node = 1; node <= totalNodes; node++)
+    {
+        for (int i = 0; i < degree; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            int adjacent = 1 + (int)((seed >> 4) % totalNodes);
+            seed = seed * 1664525u + 1013904223u;
+            if (adjacent != node)
+            {
+                graph->addEdge(node, adjacent, 1 + (int)(seed >> 8) % 1000);
+            }
+        }
+    }
+    return graph;
+}
+
+/// @brief Mide queries caminos más cortos entre nodos aleatorios y un árbol de cubrimiento mínimo.
+void run(const char *name, Graph *graph, int totalNodes, int queries)
+{
+    unsigned seed = 6789;
+    long long pathNodes = 0;
+    double dijkstraSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            int from = 1 + (int)((seed >> 4) % totalNodes);
+            seed = seed * 1664525u + 1013904223u;
+            int to = 1 + (int)((seed >> 4) % totalNodes);
+            Stack<int> *path = graph->dijkstra(from, to);
+            assert(!path->isEmpty());
+            while (!path->isEmpty())
+            {
+                path->pop();
+                pathNodes++;
+            }
+            delete path;
+        }
+    });
+    int *cost = NULL;
+    double primSeconds = measure([&]() { cost = graph->prim(1); });
+    assert(cost != NULL);
+
+    cout << name << ": Dijkstra " << dijkstraSeconds / queries * 1e3 << " ms por consulta ("
+         << (double)pathNodes / queries << " nodos por camino), Prim " << primSeconds * 1e3
+         << " ms (costo " << *cost << ")" << endl;
+    delete cost;
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 1 << 17;
+    int degree = argc > 2 ? atoi(argv[2]) : 4;
+    int queries = argc > 3 ? atoi(argv[3]) : 20;
+    int denseNodes = argc > 4 ? atoi(argv[4]) : 2000;
+    totalNodes = totalNodes > 1 ? totalNodes : 2;
+    denseNodes = denseNodes > 1 ? denseNodes : 2;
+    queries = queries > 0 ? queries : 1;
+
+    Graph *sparse = randomGraph(totalNodes, degree, false);
+    cout << totalNodes << " nodos, " << degree << " aristas aleatorias por nodo" << endl;
+    run("Listas de adyacencia", sparse, totalNodes, queries);
+    delete sparse;
+
+    // En el grafo denso cada nodo tiene aristas hacia una cuarta parte de los nodos.
+    Graph *dense = randomGraph(denseNodes, denseNodes / 4, true);
+    cout << denseNodes << " nodos, " << denseNodes / 4 << " aristas aleatorias por nodo" << endl;
+    run("Matriz", dense, denseNodes, queries);
+    delete dense;
+    return 0;
+}
@@ -0,0 +1,99 @@
+// Mide cuánto tarda Graph::hasEdge en modo de listas con cada EdgeIndexType, en un grafo dirigido con grados
+// muy desparejos: recorrer la lista del nodo (NO_EDGE_INDEX), búsqueda binaria en las filas ordenadas
+// (SORTED_ADJACENCY) y tabla de hash (HASH_INDEX), incluido lo que tarda en construirse cada índice.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/edge_lookup.cpp -o edge_lookup
+// Uso: ./edge_lookup [nodos] [aristas por nodo] [consultas]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "graph.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Retorna un nodo entre 1 y totalNodes, con los de número bajo mucho más frecuentes: el nodo es
+/// totalNodes * r^3 con r uniforme en [0, 1).
+int skewedNode(unsigned &seed, int totalNodes)
+{
+    seed = seed * 1664525u + 1013904223u;
+    double r = (seed >> 8) / 16777216.0;
+    int node = 1 + (int)(totalNodes * r * r * r);
+    return node <= totalNodes ? node : totalNodes;
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 1000000;
+    int degree = argc > 2 ? atoi(argv[2]) : 10;
+    int queries = argc > 3 ? atoi(argv[3]) : 200000;
+    totalNodes = totalNodes > 0 ? totalNodes : 1;
+    degree = degree > 0 ? degree : 1;
+    queries = queries > 0 ? queries : 1;
+
+    // Los orígenes siguen la distribución de skewedNode, así que los primeros nodos tienen miles de aristas.
+    Graph graph(totalNodes, true, true, false);
+    unsigned seed = 12345;
+    long long totalEdges = (long long)totalNodes * degree;
+    for (long long i = 0; i < totalEdges; i++)
+    {
+        int from = skewedNode(seed, totalNodes);
+        seed = seed * 1664525u + 1013904223u;
+        graph.addEdge(from, 1 + (int)((seed >> 4) % totalNodes), 1 + (int)((seed >> 8) % 100));
+    }
+    // Las consultas salen de la misma distribución, y la mitad son aristas que existen.
+    int *from = new int[queries];
+    int *to = new int[queries];
+    CSRGraph *csr = graph.toCSR();
+    int maxDegree = 0;
+    for (int u = 1; u <= totalNodes; u++)
+    {
+        maxDegree = csr->outDegree(u) > maxDegree ? csr->outDegree(u) : maxDegree;
+    }
+    for (int q = 0; q < queries; q++)
+    {
+        from[q] = skewedNode(seed, totalNodes);
+        seed = seed * 1664525u + 1013904223u;
+        int edges = csr->outDegree(from[q]);
+        to[q] = q % 2 == 0 && edges > 0 ? csr->target(csr->edgesBegin(from[q]) + (int)((seed >> 4) % edges))
+                                        : 1 + (int)((seed >> 4) % totalNodes);
+    }
+    delete csr;
+    cout << totalNodes << " nodos, " << totalEdges << " aristas, grado máximo " << maxDegree << ", " << queries
+         << " consultas" << endl;
+
+    EdgeIndexType types[] = {NO_EDGE_INDEX, SORTED_ADJACENCY, HASH_INDEX};
+    const char *names[] = {"NO_EDGE_INDEX", "SORTED_ADJACENCY", "HASH_INDEX"};
+    int expected = -1;
+    for (int t = 0; t < 3; t++)
+    {
+        graph.setEdgeIndex(types[t]);
+        // La primera consulta construye el índice y, en el primer índice, también el CSR del que se copia.
+        double buildSeconds = measure([&]() { graph.hasEdge(1, 1); });
+        int found = 0;
+        double seconds = measure([&]()
+        {
+            for (int q = 0; q < queries; q++)
+            {
+                found += graph.hasEdge(from[q], to[q]);
+            }
+        });
+        assert(expected == -1 || found == expected);
+        expected = found;
+        cout << names[t] << ": construcción " << buildSeconds * 1e3 << " ms, " << seconds / queries * 1e6
+             << " us por consulta (" << found << " encontradas)" << endl;
+    }
+
+    delete[] from;
+    delete[] to;
+    return 0;
+}
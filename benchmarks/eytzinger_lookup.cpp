@@ -0,0 +1,88 @@
+// Mide cuántas búsquedas por segundo hace el índice de Eytzinger que produce AVL::freeze(), frente a una
+// búsqueda binaria sobre el arreglo ordenado y a un std::set, que es un árbol de punteros como el AVL.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -Iheaders benchmarks/eytzinger_lookup.cpp -o eytzinger_lookup
+// Uso: ./eytzinger_lookup [elementos] [búsquedas]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+#include <set>
+using namespace std;
+
+#include "avl.h"
+
+/// @brief Hace queries búsquedas de claves pseudoaleatorias en [0, 2 * size) con lookup(key) y retorna
+/// las búsquedas por segundo.
+template <class L>
+double measure(int size, int queries, L lookup)
+{
+    unsigned key = 12345;
+    long long found = 0;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++)
+    {
+        key = key * 1664525u + 1013904223u;
+        found += lookup((int)(key % (2u * size)));
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    // Se usa el resultado para que el compilador no quite las búsquedas.
+    assert(found <= queries);
+    return queries / seconds;
+}
+
+int main(int argc, char **argv)
+{
+    int size = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int queries = argc > 2 ? atoi(argv[2]) : 1 << 22;
+    size = size > 0 ? size : 1;
+
+    // Las claves pares están en las estructuras, así que la mitad de las búsquedas fallan.
+    AVL<int> tree;
+    set<int> pointerSet;
+    int *sorted = new int[size];
+    for (int i = 0; i < size; i++)
+    {
+        int key = (int)((2LL * i * 40503) % (2LL * size)) & ~1;
+        tree.insert(key);
+        pointerSet.insert(key);
+    }
+    int count = 0;
+    for (set<int>::iterator it = pointerSet.begin(); it != pointerSet.end(); ++it)
+    {
+        sorted[count++] = *it;
+    }
+    EytzingerIndex<int> *index = tree.freeze();
+    assert(index->size() == count);
+
+    auto indexLookup = [&](int key) { return index->contains(key) ? 1 : 0; };
+    auto binaryLookup = [&](int key)
+    {
+        int low = 0;
+        int high = count;
+        while (low < high)
+        {
+            int middle = low + (high - low) / 2;
+            if (sorted[middle] < key)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        return low < count && sorted[low] == key ? 1 : 0;
+    };
+    auto setLookup = [&](int key) { return pointerSet.count(key) > 0 ? 1 : 0; };
+
+    cout << count << " elementos, " << queries << " búsquedas" << endl;
+    cout << "EytzingerIndex: " << measure(size, queries, indexLookup) / 1e6 << " M búsquedas/s, "
+         << index->memoryUsage() / 1024 << " KB" << endl;
+    cout << "Búsqueda binaria: " << measure(size, queries, binaryLookup) / 1e6 << " M búsquedas/s" << endl;
+    cout << "std::set: " << measure(size, queries, setLookup) / 1e6 << " M búsquedas/s" << endl;
+
+    delete index;
+    delete[] sorted;
+    return 0;
+}
@@ -0,0 +1,119 @@
+// Mide cuánto tarda GraphIO en cargar una lista de aristas en texto con 1 a varios hilos, frente a leerla con
+// ifstream y cargarla con Graph::addEdge y toCSR, y cuánto tardan writeBinary y mapBinary con un recorrido
+// de todas las aristas mapeadas.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/graph_loading.cpp -o graph_loading
+// Uso: ./graph_loading [nodos] [aristas por nodo] [máximo de hilos] [prefijo de los archivos temporales]
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cassert>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+using namespace std;
+
+#include "graph.h"
+#include "graphio.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Retorna una suma de los destinos y pesos de cada arista, que depende del orden de las aristas.
+unsigned long long checksum(const CSRGraph &graph)
+{
+    unsigned long long sum = 0;
+    for (int u = 1; u <= graph.totalNodes(); u++)
+    {
+        for (int e = graph.edgesBegin(u); e < graph.edgesEnd(u); e++)
+        {
+            sum = sum * 31 + (unsigned long long)graph.target(e) * 1009 + graph.weight(e);
+        }
+    }
+    return sum;
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int degree = argc > 2 ? atoi(argv[2]) : 8;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : 8;
+    string prefix = argc > 4 ? argv[4] : "graph_loading";
+    totalNodes = totalNodes > 0 ? totalNodes : 1;
+    degree = degree > 0 ? degree : 1;
+    maxThreads = maxThreads > 0 ? maxThreads : 1;
+    string textName = prefix + ".txt";
+    string binaryName = prefix + ".bin";
+
+    // Lista dirigida y con pesos, con una arista "origen destino peso" por línea.
+    int totalEdges = totalNodes * degree;
+    {
+        ofstream text(textName.c_str());
+        text << "# " << totalNodes << " nodos, " << totalEdges << " aristas\n";
+        unsigned seed = 12345;
+        for (int i = 0; i < totalEdges; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            int from = 1 + (int)((seed >> 4) % totalNodes);
+            seed = seed * 1664525u + 1013904223u;
+            text << from << ' ' << 1 + (int)((seed >> 4) % totalNodes) << ' ' << 1 + (int)((seed >> 8) % 1000) << '\n';
+        }
+    }
+    cout << totalNodes << " nodos, " << totalEdges << " aristas, " << ThreadPool::hardwareThreads() << " núcleos"
+         << endl;
+
+    CSRGraph *reference = NULL;
+    double addEdgeSeconds = measure([&]()
+    {
+        ifstream text(textName.c_str());
+        string comment;
+        getline(text, comment);
+        Graph graph(totalNodes, true, true, false);
+        int from, to, weight;
+        while (text >> from >> to >> weight)
+        {
+            graph.addEdge(from, to, weight);
+        }
+        reference = graph.toCSR();
+    });
+    unsigned long long expected = checksum(*reference);
+    cout << "ifstream, Graph::addEdge y toCSR: " << addEdgeSeconds * 1e3 << " ms" << endl;
+
+    // La primera carga paga los fallos de página de los arreglos grandes, que las siguientes reusan del heap:
+    // se hace antes de medir.
+    delete GraphIO::readEdgeList(textName.c_str(), true, true, 1);
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        CSRGraph *graph = NULL;
+        double seconds = measure([&]() { graph = GraphIO::readEdgeList(textName.c_str(), true, true, threads); });
+        assert(graph != NULL && graph->totalEdges() == reference->totalEdges() && checksum(*graph) == expected);
+        cout << "readEdgeList con " << threads << " hilos: " << seconds * 1e3 << " ms" << endl;
+        delete graph;
+    }
+
+    bool written = false;
+    double writeSeconds = measure([&]() { written = GraphIO::writeBinary(*reference, binaryName.c_str()); });
+    assert(written);
+    CSRGraph *mapped = NULL;
+    unsigned long long mappedChecksum = 0;
+    double mapSeconds = measure([&]()
+    {
+        mapped = GraphIO::mapBinary(binaryName.c_str());
+        mappedChecksum = checksum(*mapped);
+    });
+    assert(mappedChecksum == expected);
+    cout << "writeBinary: " << writeSeconds * 1e3 << " ms, mapBinary y recorrido de las aristas: " << mapSeconds * 1e3
+         << " ms" << endl;
+
+    delete mapped;
+    delete reference;
+    remove(textName.c_str());
+    remove(binaryName.c_str());
+    return 0;
+}
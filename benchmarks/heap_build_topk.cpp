@@ -0,0 +1,104 @@
+// Mide cuánto tarda Heap en construirse de abajo hacia arriba en O(n) frente a agregar los elementos uno
+// por uno, cuánto tarda heapSort en el lugar, y cuántos elementos por segundo filtra TopK de un flujo.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -Iheaders benchmarks/heap_build_topk.cpp -o heap_build_topk
+// Uso: ./heap_build_topk [elementos] [k]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "topk.h"
+
+typedef Heap<int, MinComparator<int>, 4> IntHeap;
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int size = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    int k = argc > 2 ? atoi(argv[2]) : 100;
+    size = size > 0 ? size : 1;
+    k = k > 0 ? k : 1;
+
+    int *elements = new int[size];
+    unsigned key = 12345;
+    for (int i = 0; i < size; i++)
+    {
+        key = key * 1664525u + 1013904223u;
+        elements[i] = (int)(key >> 1);
+    }
+
+    IntHeap *built = NULL;
+    double heapifySeconds = measure([&]() { built = new IntHeap(elements, size); });
+    IntHeap *added = new IntHeap(size);
+    double addSeconds = measure([&]()
+    {
+        for (int i = 0; i < size; i++)
+        {
+            added->add(elements[i]);
+        }
+    });
+    assert(built->top() == added->top());
+
+    // En orden descendente cada agregado de un minheap sube hasta la raíz: es el peor caso de add.
+    int *descending = new int[size];
+    for (int i = 0; i < size; i++)
+    {
+        descending[i] = size - i;
+    }
+    IntHeap *descendingBuilt = NULL;
+    double descendingHeapifySeconds = measure([&]() { descendingBuilt = new IntHeap(descending, size); });
+    IntHeap *descendingAdded = new IntHeap(size);
+    double descendingAddSeconds = measure([&]()
+    {
+        for (int i = 0; i < size; i++)
+        {
+            descendingAdded->add(descending[i]);
+        }
+    });
+    assert(descendingBuilt->top() == 1 && descendingAdded->top() == 1);
+
+    // Un minheap queda ordenado de mayor a menor.
+    int count = 0;
+    double sortSeconds = measure([&]() { count = built->heapSort(); });
+    const int *sorted = built->getArray();
+    for (int i = 2; i <= count; i++)
+    {
+        assert(sorted[i - 1] >= sorted[i]);
+    }
+
+    TopK<int, MinComparator<int>, 4> topK(k);
+    double topKSeconds = measure([&]()
+    {
+        for (int i = 0; i < size; i++)
+        {
+            topK.offer(elements[i]);
+        }
+    });
+    assert(topK.worst() == sorted[count - (k < count ? k : count) + 1]);
+
+    cout << size << " elementos, k = " << k << endl;
+    cout << "Construcción en O(n): " << heapifySeconds * 1e3 << " ms" << endl;
+    cout << "Construcción agregando uno por uno: " << addSeconds * 1e3 << " ms" << endl;
+    cout << "Construcción en O(n), orden descendente: " << descendingHeapifySeconds * 1e3 << " ms" << endl;
+    cout << "Agregando uno por uno, orden descendente: " << descendingAddSeconds * 1e3 << " ms" << endl;
+    cout << "heapSort en el lugar: " << sortSeconds * 1e3 << " ms" << endl;
+    cout << "TopK: " << size / topKSeconds / 1e6 << " M elementos/s" << endl;
+
+    delete built;
+    delete added;
+    delete descendingBuilt;
+    delete descendingAdded;
+    delete[] descending;
+    delete[] elements;
+    return 0;
+}
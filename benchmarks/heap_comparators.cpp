@@ -0,0 +1,54 @@
+// Mide cuántas operaciones por segundo hace Heap con el comparador por defecto, que decide MIN o MAX en
+// tiempo de ejecución, frente a MinComparator con aridad 2, 4 y 8.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -Iheaders benchmarks/heap_comparators.cpp -o heap_comparators
+// Uso: ./heap_comparators [elementos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "heap.h"
+
+/// @brief Agrega size claves pseudoaleatorias al heap, las quita todas comprobando el orden y retorna
+/// las operaciones (agregados más quitas) por segundo.
+template <class H>
+double measure(H &heap, int size)
+{
+    unsigned key = 12345;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < size; i++)
+    {
+        key = key * 1664525u + 1013904223u;
+        heap.add((int)(key >> 1));
+    }
+    int previous = -1;
+    while (!heap.isEmpty())
+    {
+        int top = heap.top();
+        assert(previous <= top);
+        previous = top;
+        heap.removeTop();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return 2.0 * size / seconds;
+}
+
+int main(int argc, char **argv)
+{
+    int size = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    size = size > 0 ? size : 1;
+
+    Heap<int> typeHeap(size, MIN);
+    Heap<int, MinComparator<int>, 2> binaryHeap(size);
+    Heap<int, MinComparator<int>, 4> quaternaryHeap(size);
+    Heap<int, MinComparator<int>, 8> octaryHeap(size);
+
+    cout << size << " elementos" << endl;
+    cout << "Heap(size, MIN): " << measure(typeHeap, size) / 1e6 << " M operaciones/s" << endl;
+    cout << "MinComparator, aridad 2: " << measure(binaryHeap, size) / 1e6 << " M operaciones/s" << endl;
+    cout << "MinComparator, aridad 4: " << measure(quaternaryHeap, size) / 1e6 << " M operaciones/s" << endl;
+    cout << "MinComparator, aridad 8: " << measure(octaryHeap, size) / 1e6 << " M operaciones/s" << endl;
+    return 0;
+}
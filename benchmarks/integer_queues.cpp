@@ -0,0 +1,111 @@
+// Mide cuánto tarda Graph::dijkstra con cada cola de prioridad (BINARY_HEAP, RADIX_HEAP y BUCKET_QUEUE), y
+// Graph::prim con BINARY_HEAP y BUCKET_QUEUE, con pesos máximos pequeños y grandes.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -Iheaders benchmarks/integer_queues.cpp -o integer_queues
+// Uso: ./integer_queues [nodos] [aristas por nodo] [consultas]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "graph.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Crea un grafo no dirigido con listas de adyacencia, con un camino 1, 2, ..., totalNodes para que
+/// sea conexo, y degree aristas aleatorias más por nodo, de pesos entre 1 y maxWeight.
+Graph *randomGraph(int totalNodes, int degree, int maxWeight)
+{
+    Graph *graph = new Graph(totalNodes, false, true, false);
+    unsigned seed = 12345;
+    for (int node = 1; node < totalNodes; node++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        graph->addEdge(node, node + 1, 1 + (int)((seed >> 8) % maxWeight));
+    }
+    for (int node = 1; node <= totalNodes; node++)
+    {
+        for (int i = 0; i < degree; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            int adjacent = 1 + (int)((seed >> 4) % totalNodes);
+            seed = seed * 1664525u + 1013904223u;
+            if (adjacent != node)
+            {
+                graph->addEdge(node, adjacent, 1 + (int)((seed >> 8) % maxWeight));
+            }
+        }
+    }
+    return graph;
+}
+
+/// @brief Retorna el costo total de queries caminos más cortos entre nodos aleatorios, calculados con la cola dada.
+long long shortestPaths(Graph *graph, int totalNodes, int queries, PriorityQueueType queueType)
+{
+    unsigned seed = 6789;
+    long long totalCost = 0;
+    for (int q = 0; q < queries; q++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        int from = 1 + (int)((seed >> 4) % totalNodes);
+        seed = seed * 1664525u + 1013904223u;
+        int to = 1 + (int)((seed >> 4) % totalNodes);
+        Stack<int> *path = graph->dijkstra(from, to, queueType);
+        int node = path->peek();
+        path->pop();
+        while (!path->isEmpty())
+        {
+            totalCost += graph->edgeWeight(node, path->peek());
+            node = path->peek();
+            path->pop();
+        }
+        delete path;
+    }
+    return totalCost;
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 1 << 17;
+    int degree = argc > 2 ? atoi(argv[2]) : 4;
+    int queries = argc > 3 ? atoi(argv[3]) : 10;
+    totalNodes = totalNodes > 1 ? totalNodes : 2;
+    queries = queries > 0 ? queries : 1;
+
+    const char *queueNames[] = {"BINARY_HEAP", "RADIX_HEAP", "BUCKET_QUEUE"};
+    int maxWeights[] = {16, 1 << 20};
+    cout << totalNodes << " nodos, " << degree << " aristas aleatorias por nodo, " << queries << " consultas" << endl;
+    for (int w = 0; w < 2; w++)
+    {
+        Graph *graph = randomGraph(totalNodes, degree, maxWeights[w]);
+        cout << "Pesos entre 1 y " << maxWeights[w] << ":" << endl;
+        long long expectedCost = -1;
+        for (int q = 0; q < 3; q++)
+        {
+            long long cost = 0;
+            double seconds = measure([&]() { cost = shortestPaths(graph, totalNodes, queries, (PriorityQueueType)q); });
+            assert(expectedCost == -1 || cost == expectedCost);
+            expectedCost = cost;
+            cout << "  Dijkstra con " << queueNames[q] << ": " << seconds / queries * 1e3 << " ms por consulta" << endl;
+        }
+        int *binaryCost = NULL;
+        int *bucketCost = NULL;
+        double binarySeconds = measure([&]() { binaryCost = graph->prim(1, BINARY_HEAP); });
+        double bucketSeconds = measure([&]() { bucketCost = graph->prim(1, BUCKET_QUEUE); });
+        assert(*binaryCost == *bucketCost);
+        cout << "  Prim con BINARY_HEAP: " << binarySeconds * 1e3 << " ms, con BUCKET_QUEUE: "
+             << bucketSeconds * 1e3 << " ms" << endl;
+        delete binaryCost;
+        delete bucketCost;
+        delete graph;
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+// Mide cuántas consultas de punto y de rango por segundo responde IntervalTree, frente a recorrer un
+// arreglo con todos los intervalos, y cuántas inserciones y bajas por segundo soporta.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -Iheaders benchmarks/intervaltree_queries.cpp -o intervaltree_queries
+// Uso: ./intervaltree_queries [intervalos] [consultas] [largo máximo de los intervalos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "intervaltree.h"
+
+const int DOMAIN = 1 << 30;
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int size = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int queries = argc > 2 ? atoi(argv[2]) : 1 << 16;
+    int maxLength = argc > 3 ? atoi(argv[3]) : 1 << 12;
+    size = size > 0 ? size : 1;
+    maxLength = maxLength > 0 ? maxLength : 1;
+
+    int *lows = new int[size];
+    int *highs = new int[size];
+    unsigned seed = 12345;
+    for (int i = 0; i < size; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        lows[i] = (int)(seed % DOMAIN);
+        seed = seed * 1664525u + 1013904223u;
+        highs[i] = lows[i] + (int)(seed % maxLength);
+    }
+
+    IntervalTree<int> tree;
+    double insertSeconds = measure([&]()
+    {
+        for (int i = 0; i < size; i++)
+        {
+            tree.insert(lows[i], highs[i]);
+        }
+    });
+
+    // Los rangos consultados miden lo mismo que el intervalo más largo.
+    int *points = new int[queries];
+    for (int q = 0; q < queries; q++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        points[q] = (int)(seed % DOMAIN);
+    }
+    long long treeStabbed = 0;
+    long long treeOverlapped = 0;
+    auto countStabbed = [&](const IntervalTree<int>::Interval &) { treeStabbed++; };
+    auto countOverlapped = [&](const IntervalTree<int>::Interval &) { treeOverlapped++; };
+    double stabSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            tree.forEachStabbing(points[q], countStabbed);
+        }
+    });
+    double overlapSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            tree.forEachOverlapping(points[q], points[q] + maxLength, countOverlapped);
+        }
+    });
+
+    // El recorrido lineal es mucho más lento, así que se mide con menos consultas.
+    int scanQueries = queries / 64 > 0 ? queries / 64 : 1;
+    long long scanStabbed = 0;
+    long long expectedStabbed = 0;
+    double scanSeconds = measure([&]()
+    {
+        for (int q = 0; q < scanQueries; q++)
+        {
+            for (int i = 0; i < size; i++)
+            {
+                scanStabbed += lows[i] <= points[q] && points[q] <= highs[i];
+            }
+        }
+    });
+    auto countExpected = [&](const IntervalTree<int>::Interval &) { expectedStabbed++; };
+    for (int q = 0; q < scanQueries; q++)
+    {
+        tree.forEachStabbing(points[q], countExpected);
+    }
+    assert(scanStabbed == expectedStabbed);
+
+    double removeSeconds = measure([&]()
+    {
+        for (int i = 0; i < size; i++)
+        {
+            tree.remove(lows[i], highs[i]);
+        }
+    });
+    assert(tree.isEmpty());
+
+    cout << size << " intervalos de largo menor a " << maxLength << ", " << queries << " consultas" << endl;
+    cout << "Inserciones: " << size / insertSeconds / 1e6 << " M/s, bajas: " << size / removeSeconds / 1e6 << " M/s" << endl;
+    cout << "Consultas de punto: " << queries / stabSeconds / 1e6 << " M/s, "
+         << (double)treeStabbed / queries << " resultados por consulta" << endl;
+    cout << "Consultas de rango: " << queries / overlapSeconds / 1e6 << " M/s, "
+         << (double)treeOverlapped / queries << " resultados por consulta" << endl;
+    cout << "Recorrido lineal, consultas de punto: " << scanQueries / scanSeconds / 1e6 << " M/s" << endl;
+
+    delete[] lows;
+    delete[] highs;
+    delete[] points;
+    return 0;
+}
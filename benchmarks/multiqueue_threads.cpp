@@ -0,0 +1,140 @@
+// Mide cuántas operaciones por segundo hace MultiQueue con 1 a 64 hilos, frente a un PQueue protegido por un
+// mutex, y cuánto se aleja del elemento más prioritario: el error de rango de cada elemento quitado es la
+// cantidad de elementos más prioritarios que seguían en la cola.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/multiqueue_threads.cpp -o multiqueue_threads
+// Uso: ./multiqueue_threads [máximo de hilos] [segundos por medición] [elementos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#include "multiqueue.h"
+#include "pqueue.h"
+
+/// @brief Ejecuta threads hilos que llaman a step(i) durante seconds segundos y retorna las llamadas
+/// por segundo de todos los hilos juntos.
+template <class S>
+double measure(int threads, double seconds, S step)
+{
+    std::atomic<bool> done(false);
+    std::atomic<long long> steps(0);
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&]()
+        {
+            long long count = 0;
+            while (!done.load(std::memory_order_relaxed))
+            {
+                step(count++);
+            }
+            steps.fetch_add(count);
+        });
+    }
+    this_thread::sleep_for(chrono::duration<double>(seconds));
+    done.store(true);
+    for (int t = 0; t < threads; t++)
+    {
+        workers[t].join();
+    }
+    return steps.load() / seconds;
+}
+
+/// @brief Vacía con un hilo una MultiQueue de queueCount heaps con las prioridades 0 a size - 1 y retorna el
+/// error de rango medio, contando con un árbol de Fenwick cuántas prioridades menores siguen en la cola.
+double averageRankError(int queueCount, int size)
+{
+    MultiQueue<int> queue(queueCount, 1);
+    int *fenwick = new int[size + 1];
+    for (int i = 0; i <= size; i++)
+    {
+        fenwick[i] = 0;
+    }
+    unsigned seed = 12345;
+    int *priorities = new int[size];
+    for (int i = 0; i < size; i++)
+    {
+        priorities[i] = i;
+    }
+    for (int i = size - 1; i > 0; i--)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        int j = (int)((seed >> 4) % (unsigned)(i + 1));
+        int swap = priorities[i];
+        priorities[i] = priorities[j];
+        priorities[j] = swap;
+    }
+    for (int i = 0; i < size; i++)
+    {
+        queue.enqueue(priorities[i], priorities[i]);
+        for (int k = priorities[i] + 1; k <= size; k += k & -k)
+        {
+            fenwick[k]++;
+        }
+    }
+    long long totalError = 0;
+    int value;
+    int priority;
+    while (queue.tryDequeue(value, priority))
+    {
+        for (int k = priority; k > 0; k -= k & -k)
+        {
+            totalError += fenwick[k];
+        }
+        for (int k = priority + 1; k <= size; k += k & -k)
+        {
+            fenwick[k]--;
+        }
+    }
+    delete[] fenwick;
+    delete[] priorities;
+    return (double)totalError / size;
+}
+
+int main(int argc, char **argv)
+{
+    int maxThreads = argc > 1 ? atoi(argv[1]) : 64;
+    double seconds = argc > 2 ? atof(argv[2]) : 0.5;
+    int size = argc > 3 ? atoi(argv[3]) : 1 << 20;
+    maxThreads = maxThreads > 0 ? maxThreads : 1;
+    size = size > 0 ? size : 1;
+
+    cout << size << " elementos, " << seconds << " s por medición, " << thread::hardware_concurrency() << " núcleos" << endl;
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        // Cada paso quita un elemento y lo vuelve a agregar algo menos prioritario, así que la población se mantiene.
+        // En el PQueue el valor de cada elemento es su prioridad.
+        MultiQueue<int> multiQueue(threads);
+        PQueue<int> lockedQueue(size + threads);
+        std::mutex queueMutex;
+        for (int i = 0; i < size; i++)
+        {
+            multiQueue.enqueue(i, i);
+            lockedQueue.enqueue(i, (float)i);
+        }
+        double multiQueueRate = measure(threads, seconds, [&](long long i)
+        {
+            int value;
+            int priority;
+            if (multiQueue.tryDequeue(value, priority))
+            {
+                multiQueue.enqueue(value, priority + 1 + (int)(i & 1023));
+            }
+        });
+        double lockedQueueRate = measure(threads, seconds, [&](long long i)
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            int priority = lockedQueue.front();
+            lockedQueue.dequeue();
+            lockedQueue.enqueue(priority + 1 + (int)(i & 1023), (float)(priority + 1 + (int)(i & 1023)));
+        });
+        cout << threads << " hilos: MultiQueue " << multiQueueRate / 1e6 << " M pasos/s, error de rango medio "
+             << averageRankError(2 * threads, size) << "; PQueue + mutex " << lockedQueueRate / 1e6 << " M pasos/s" << endl;
+    }
+    return 0;
+}
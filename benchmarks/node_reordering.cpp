@@ -0,0 +1,139 @@
+// Mide cuánto mejoran los recorridos al renumerar los nodos con Reordering: en una grilla con los números de
+// nodo mezclados al azar, el tiempo de calcular y aplicar cada permutación, y el de un recorrido en anchura y
+// de DeltaStepping con un hilo sobre el grafo renumerado, frente al grafo mezclado.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/node_reordering.cpp -o node_reordering
+// Uso: ./node_reordering [lado de la grilla] [recorridos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "deltastepping.h"
+#include "reorder.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Retorna los segundos por recorrido en anchura y por DeltaStepping desde el origen dado,
+/// y deja en distances las distancias del último.
+void traversals(const CSRGraph &graph, int from, int runs, int *distances, double &bfsSeconds, double &ssspSeconds)
+{
+    long long visited = 0;
+    bfsSeconds = measure([&]()
+    {
+        for (int r = 0; r < runs; r++)
+        {
+            graph.bfSearch(from, [&](int, int) { visited++; });
+        }
+    }) / runs;
+    assert(visited == (long long)graph.totalNodes() * runs);
+    int *predecessors = new int[graph.totalNodes() + 1];
+    DeltaStepping search(graph, 0, 1);
+    ssspSeconds = measure([&]()
+    {
+        for (int r = 0; r < runs; r++)
+        {
+            search.search(from, distances, predecessors);
+        }
+    }) / runs;
+    delete[] predecessors;
+}
+
+int main(int argc, char **argv)
+{
+    int side = argc > 1 ? atoi(argv[1]) : 1000;
+    int runs = argc > 2 ? atoi(argv[2]) : 5;
+    side = side > 1 ? side : 2;
+    runs = runs > 0 ? runs : 1;
+
+    // Los nodos de la grilla se numeran con una permutación aleatoria, como en un archivo sin orden.
+    int totalNodes = side * side;
+    int *shuffled = new int[totalNodes + 1];
+    for (int i = 1; i <= totalNodes; i++)
+    {
+        shuffled[i] = i;
+    }
+    unsigned seed = 12345;
+    for (int i = totalNodes; i > 1; i--)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        int j = 1 + (int)((seed >> 4) % i);
+        int aux = shuffled[i];
+        shuffled[i] = shuffled[j];
+        shuffled[j] = aux;
+    }
+    int totalEdges = 4 * side * (side - 1);
+    int *from = new int[totalEdges];
+    int *to = new int[totalEdges];
+    int *weights = new int[totalEdges];
+    int edges = 0;
+    for (int r = 0; r < side; r++)
+    {
+        for (int c = 0; c < side; c++)
+        {
+            int node = r * side + c + 1;
+            for (int d = 0; d < 2; d++)
+            {
+                if (d == 0 ? c + 1 < side : r + 1 < side)
+                {
+                    int neighbor = d == 0 ? node + 1 : node + side;
+                    seed = seed * 1664525u + 1013904223u;
+                    int weight = 1 + (int)((seed >> 8) % 100);
+                    from[edges] = to[edges + 1] = shuffled[node];
+                    to[edges] = from[edges + 1] = shuffled[neighbor];
+                    weights[edges] = weights[edges + 1] = weight;
+                    edges += 2;
+                }
+            }
+        }
+    }
+    CSRGraph graph(totalNodes, totalEdges, from, to, weights, false);
+    delete[] from;
+    delete[] to;
+    delete[] weights;
+
+    int origin = shuffled[1];
+    int *expected = new int[totalNodes + 1];
+    int *distances = new int[totalNodes + 1];
+    int *translated = new int[totalNodes + 1];
+    double bfsSeconds, ssspSeconds;
+    traversals(graph, origin, runs, expected, bfsSeconds, ssspSeconds);
+    cout << side << " x " << side << " nodos mezclados, " << totalEdges << " aristas" << endl;
+    cout << "Sin renumerar: recorrido en anchura " << bfsSeconds * 1e3 << " ms, DeltaStepping " << ssspSeconds * 1e3
+         << " ms" << endl;
+
+    ReorderingType types[] = {REVERSE_CUTHILL_MCKEE, DEGREE_DESCENDING, WINDOW_LOCALITY};
+    const char *names[] = {"REVERSE_CUTHILL_MCKEE", "DEGREE_DESCENDING", "WINDOW_LOCALITY"};
+    for (int t = 0; t < 3; t++)
+    {
+        Reordering *reordering = NULL;
+        double computeSeconds = measure([&]() { reordering = Reordering::compute(graph, types[t]); });
+        CSRGraph *reordered = NULL;
+        double applySeconds = measure([&]() { reordered = reordering->apply(graph); });
+        traversals(*reordered, reordering->newId(origin), runs, distances, bfsSeconds, ssspSeconds);
+        reordering->toOriginal(distances, translated);
+        for (int u = 1; u <= totalNodes; u++)
+        {
+            assert(translated[u] == expected[u]);
+        }
+        cout << names[t] << ": cálculo " << computeSeconds * 1e3 << " ms, apply " << applySeconds * 1e3
+             << " ms, recorrido en anchura " << bfsSeconds * 1e3 << " ms, DeltaStepping " << ssspSeconds * 1e3 << " ms"
+             << endl;
+        delete reordered;
+        delete reordering;
+    }
+
+    delete[] shuffled;
+    delete[] expected;
+    delete[] distances;
+    delete[] translated;
+    return 0;
+}
@@ -0,0 +1,132 @@
+// Mide cuántas operaciones por segundo hace PairingHeap al agregar y quitar, al disminuir prioridades con
+// handles, y al unir muchos heaps chicos, frente a Heap e IndexedPQueue donde la operación existe.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -Iheaders benchmarks/pairingheap_ops.cpp -o pairingheap_ops
+// Uso: ./pairingheap_ops [elementos] [heaps a unir]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+#include <sys/resource.h>
+using namespace std;
+
+#include "pairingheap.h"
+#include "indexedpqueue.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int size = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int melds = argc > 2 ? atoi(argv[2]) : 1 << 18;
+    size = size > 0 ? size : 1;
+    melds = melds > 0 ? melds : 1;
+
+    int *keys = new int[size];
+    unsigned seed = 12345;
+    for (int i = 0; i < size; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        keys[i] = (int)(seed >> 2);
+    }
+
+    // Unir muchos heaps de un elemento en uno, quitando el tope cada dos uniones. Se mide primero para que la
+    // memoria máxima del proceso sea la de esta prueba.
+    PairingHeap<int> melded;
+    double meldSeconds = measure([&]()
+    {
+        for (int i = 0; i < melds; i++)
+        {
+            PairingHeap<int> single;
+            single.insert(keys[i % size]);
+            melded.meld(single);
+            if (i % 2 == 1)
+            {
+                melded.removeTop();
+            }
+        }
+    });
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    // Agregar todo y vaciar, comprobando el orden.
+    PairingHeap<int> pairingHeap;
+    Heap<int, MinComparator<int>, 4> heap(size);
+    double pairingFillSeconds = measure([&]()
+    {
+        for (int i = 0; i < size; i++)
+        {
+            pairingHeap.insert(keys[i]);
+        }
+        int previous = -1;
+        while (!pairingHeap.isEmpty())
+        {
+            assert(previous <= pairingHeap.top());
+            previous = pairingHeap.top();
+            pairingHeap.removeTop();
+        }
+    });
+    double heapFillSeconds = measure([&]()
+    {
+        for (int i = 0; i < size; i++)
+        {
+            heap.add(keys[i]);
+        }
+        while (!heap.isEmpty())
+        {
+            heap.removeTop();
+        }
+    });
+
+    // Disminuir la prioridad de cada elemento una vez, en orden aleatorio, y vaciar.
+    PairingHeap<int>::Node **handles = new PairingHeap<int>::Node *[size + 1];
+    IndexedPQueue<int> indexedQueue(size);
+    for (int i = 0; i < size; i++)
+    {
+        handles[i + 1] = pairingHeap.insert(keys[i]);
+        indexedQueue.enqueue(i + 1, keys[i]);
+    }
+    double pairingDecreaseSeconds = measure([&]()
+    {
+        for (int i = 0; i < size; i++)
+        {
+            int id = 1 + (int)((i * 40503LL) % size);
+            pairingHeap.decreaseKey(handles[id], keys[id - 1] / 2);
+        }
+        while (!pairingHeap.isEmpty())
+        {
+            pairingHeap.removeTop();
+        }
+    });
+    double indexedDecreaseSeconds = measure([&]()
+    {
+        for (int i = 0; i < size; i++)
+        {
+            int id = 1 + (int)((i * 40503LL) % size);
+            indexedQueue.decreaseKey(id, keys[id - 1] / 2);
+        }
+        while (!indexedQueue.isEmpty())
+        {
+            indexedQueue.dequeue();
+        }
+    });
+
+    cout << size << " elementos" << endl;
+    cout << "Agregar y vaciar: PairingHeap " << 2.0 * size / pairingFillSeconds / 1e6 << " M operaciones/s, Heap de aridad 4 "
+         << 2.0 * size / heapFillSeconds / 1e6 << " M operaciones/s" << endl;
+    cout << "decreaseKey y vaciar: PairingHeap " << 2.0 * size / pairingDecreaseSeconds / 1e6 << " M operaciones/s, IndexedPQueue "
+         << 2.0 * size / indexedDecreaseSeconds / 1e6 << " M operaciones/s" << endl;
+    cout << melds << " uniones de heaps de un elemento: " << melds / meldSeconds / 1e6 << " M uniones/s, "
+         << melded.size() << " elementos al final, memoria máxima del proceso " << usage.ru_maxrss / 1024 << " MB" << endl;
+
+    delete[] handles;
+    delete[] keys;
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Mide cuánto tarda ParallelBFS, el recorrido en anchura de dirección optimizada, con 1 a varios hilos,
+// frente al recorrido en anchura secuencial de CSRGraph, en un grafo aleatorio de diámetro chico.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/parallel_bfs.cpp -o parallel_bfs
+// Uso: ./parallel_bfs [nodos] [aristas por nodo] [máximo de hilos] [orígenes]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "parallelbfs.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int degree = argc > 2 ? atoi(argv[2]) : 16;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : 8;
+    int sources = argc > 4 ? atoi(argv[4]) : 8;
+    totalNodes = totalNodes > 0 ? totalNodes : 1;
+    degree = degree > 0 ? degree : 1;
+    maxThreads = maxThreads > 0 ? maxThreads : 1;
+    sources = sources > 0 ? sources : 1;
+
+    // Grafo no dirigido: cada arista aleatoria figura en ambos sentidos.
+    int totalEdges = totalNodes * degree;
+    int *from = new int[totalEdges];
+    int *to = new int[totalEdges];
+    unsigned seed = 12345;
+    for (int i = 0; i < totalEdges; i += 2)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        from[i] = to[i + 1] = 1 + (int)((seed >> 4) % totalNodes);
+        seed = seed * 1664525u + 1013904223u;
+        to[i] = from[i + 1] = 1 + (int)((seed >> 4) % totalNodes);
+    }
+    CSRGraph graph(totalNodes, totalEdges, from, to, NULL, false, maxThreads);
+    CSRGraph *reverse = graph.transpose(maxThreads);
+    delete[] from;
+    delete[] to;
+
+    int *parents = new int[totalNodes + 1];
+    int *depths = new int[totalNodes + 1];
+    long long reached = 0;
+    double sequentialSeconds = measure([&]()
+    {
+        for (int s = 0; s < sources; s++)
+        {
+            graph.bfSearch(1 + (int)((s * 40503LL) % totalNodes), [&](int, int) { reached++; });
+        }
+    });
+    cout << totalNodes << " nodos, " << totalEdges << " aristas, " << sources << " orígenes, "
+         << ThreadPool::hardwareThreads() << " núcleos" << endl;
+    cout << "CSRGraph::bfSearch: " << sequentialSeconds / sources * 1e3 << " ms por recorrido" << endl;
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        ParallelBFS search(graph, *reverse, threads);
+        long long parallelReached = 0;
+        int levels = 0;
+        double seconds = measure([&]()
+        {
+            for (int s = 0; s < sources; s++)
+            {
+                levels = search.search(1 + (int)((s * 40503LL) % totalNodes), parents, depths);
+                for (int u = 1; u <= totalNodes; u++)
+                {
+                    parallelReached += depths[u] >= 0;
+                }
+            }
+        });
+        assert(parallelReached == reached);
+        cout << "ParallelBFS con " << threads << " hilos: " << seconds / sources * 1e3 << " ms por recorrido, "
+             << levels << " niveles" << endl;
+    }
+
+    delete reverse;
+    delete[] parents;
+    delete[] depths;
+    return 0;
+}
@@ -0,0 +1,133 @@
+// Mide cuántas búsquedas por segundo hacen los lectores de PersistentAVL, sin escritor y con un escritor
+// que inserta y quita elementos todo el tiempo, y lo compara con un std::set protegido por un mutex.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/persistentavl_readers.cpp -o persistentavl_readers
+// Uso: ./persistentavl_readers [lectores] [segundos por medición]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#include "persistentavl.h"
+
+const int KEYS = 1 << 20;
+
+/// @brief Ejecuta readers hilos que llaman a lookup(key) durante seconds segundos, con o sin un hilo que
+/// llama a write(i), y retorna las búsquedas por segundo de todos los lectores juntos.
+template <class L, class W>
+double measure(int readers, double seconds, bool withWriter, L lookup, W write, long long &writes)
+{
+    std::atomic<bool> done(false);
+    std::atomic<long long> lookups(0);
+    writes = 0;
+    vector<thread> threads;
+    for (int r = 0; r < readers; r++)
+    {
+        threads.emplace_back([&, r]()
+        {
+            unsigned key = 2654435761u * (r + 1);
+            long long count = 0;
+            long long found = 0;
+            while (!done.load(std::memory_order_relaxed))
+            {
+                key = key * 1664525u + 1013904223u;
+                found += lookup((int)(key % (2 * KEYS)));
+                count++;
+            }
+            lookups.fetch_add(count);
+            // Se usa el resultado para que el compilador no quite las búsquedas.
+            assert(found <= count);
+        });
+    }
+    thread writer;
+    if (withWriter)
+    {
+        writer = thread([&]()
+        {
+            long long i = 0;
+            while (!done.load(std::memory_order_relaxed))
+            {
+                write(i++);
+            }
+            writes = i;
+        });
+    }
+    this_thread::sleep_for(chrono::duration<double>(seconds));
+    done.store(true);
+    for (int r = 0; r < readers; r++)
+    {
+        threads[r].join();
+    }
+    if (withWriter)
+    {
+        writer.join();
+    }
+    return lookups.load() / seconds;
+}
+
+int main(int argc, char **argv)
+{
+    int readers = argc > 1 ? atoi(argv[1]) : (int)thread::hardware_concurrency();
+    double seconds = argc > 2 ? atof(argv[2]) : 2;
+    readers = readers > 0 ? readers : 1;
+
+    // Las claves pares están en el árbol; el escritor quita una y la vuelve a insertar.
+    PersistentAVL<int> tree;
+    set<int> lockedSet;
+    std::mutex setMutex;
+    for (int i = 0; i < KEYS; i++)
+    {
+        tree.insert(2 * i);
+        lockedSet.insert(2 * i);
+    }
+
+    auto treeLookup = [&](int key) { return tree.contains(key) ? 1 : 0; };
+    auto treeWrite = [&](long long i)
+    {
+        int key = (int)(2 * ((i / 2) % KEYS));
+        if (i % 2 == 0)
+        {
+            tree.remove(key);
+        }
+        else
+        {
+            tree.insert(key);
+        }
+    };
+    auto setLookup = [&](int key)
+    {
+        std::lock_guard<std::mutex> lock(setMutex);
+        return lockedSet.count(key) > 0 ? 1 : 0;
+    };
+    auto setWrite = [&](long long i)
+    {
+        int key = (int)(2 * ((i / 2) % KEYS));
+        std::lock_guard<std::mutex> lock(setMutex);
+        if (i % 2 == 0)
+        {
+            lockedSet.erase(key);
+        }
+        else
+        {
+            lockedSet.insert(key);
+        }
+    };
+
+    cout << readers << " lectores, " << KEYS << " claves, " << seconds << " s por medición" << endl;
+    long long writes;
+    for (int withWriter = 0; withWriter < 2; withWriter++)
+    {
+        double treeRate = measure(readers, seconds, withWriter, treeLookup, treeWrite, writes);
+        cout << "PersistentAVL " << (withWriter ? "con escritor: " : "sin escritor: ") << treeRate / 1e6 << " M búsquedas/s";
+        cout << (withWriter ? ", " + to_string(writes / seconds / 1e3) + " K escrituras/s" : "") << endl;
+        double setRate = measure(readers, seconds, withWriter, setLookup, setWrite, writes);
+        cout << "std::set + mutex " << (withWriter ? "con escritor: " : "sin escritor: ") << setRate / 1e6 << " M búsquedas/s";
+        cout << (withWriter ? ", " + to_string(writes / seconds / 1e3) + " K escrituras/s" : "") << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,122 @@
+// Mide cuánto tardan las búsquedas de un camino más corto entre dos nodos: Graph::dijkstra,
+// Graph::bidirectionalDijkstra y Graph::aStar con la distancia Manhattan, en una grilla con pesos aleatorios.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/point_to_point.cpp -o point_to_point
+// Uso: ./point_to_point [lado de la grilla] [consultas]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "graph.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Retorna el costo del camino y libera el stack.
+long long pathCost(Graph &graph, Stack<int> *path)
+{
+    long long cost = 0;
+    int node = path->peek();
+    path->pop();
+    while (!path->isEmpty())
+    {
+        cost += graph.edgeWeight(node, path->peek());
+        node = path->peek();
+        path->pop();
+    }
+    delete path;
+    return cost;
+}
+
+int main(int argc, char **argv)
+{
+    int side = argc > 1 ? atoi(argv[1]) : 512;
+    int queries = argc > 2 ? atoi(argv[2]) : 20;
+    side = side > 1 ? side : 2;
+    queries = queries > 0 ? queries : 1;
+
+    // El nodo de la fila r y la columna c es r * side + c + 1. Los pesos van de 1 a 10, así que la distancia
+    // Manhattan es una cota inferior válida para A*.
+    int totalNodes = side * side;
+    Graph graph(totalNodes, false, true, false);
+    unsigned seed = 12345;
+    for (int r = 0; r < side; r++)
+    {
+        for (int c = 0; c < side; c++)
+        {
+            int node = r * side + c + 1;
+            seed = seed * 1664525u + 1013904223u;
+            if (c + 1 < side)
+            {
+                graph.addEdge(node, node + 1, 1 + (int)((seed >> 8) % 10));
+            }
+            seed = seed * 1664525u + 1013904223u;
+            if (r + 1 < side)
+            {
+                graph.addEdge(node, node + side, 1 + (int)((seed >> 8) % 10));
+            }
+        }
+    }
+
+    int *sources = new int[queries];
+    int *targets = new int[queries];
+    for (int q = 0; q < queries; q++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        sources[q] = 1 + (int)((seed >> 4) % totalNodes);
+        seed = seed * 1664525u + 1013904223u;
+        targets[q] = 1 + (int)((seed >> 4) % totalNodes);
+    }
+
+    long long dijkstraCost = 0;
+    long long bidirectionalCost = 0;
+    long long aStarCost = 0;
+    double dijkstraSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            dijkstraCost += pathCost(graph, graph.dijkstra(sources[q], targets[q]));
+        }
+    });
+    // La primera búsqueda bidireccional construye el CSR y su transpuesto: se hace antes de medir.
+    delete graph.bidirectionalDijkstra(1, 1);
+    double bidirectionalSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            bidirectionalCost += pathCost(graph, graph.bidirectionalDijkstra(sources[q], targets[q]));
+        }
+    });
+    double aStarSeconds = measure([&]()
+    {
+        for (int q = 0; q < queries; q++)
+        {
+            int targetRow = (targets[q] - 1) / side;
+            int targetColumn = (targets[q] - 1) % side;
+            aStarCost += pathCost(graph, graph.aStar(sources[q], targets[q], [&](int node)
+            {
+                int row = (node - 1) / side;
+                int column = (node - 1) % side;
+                return (row > targetRow ? row - targetRow : targetRow - row) + (column > targetColumn ? column - targetColumn : targetColumn - column);
+            }));
+        }
+    });
+    assert(dijkstraCost == bidirectionalCost && dijkstraCost == aStarCost);
+
+    cout << side << " x " << side << " nodos, " << queries << " consultas" << endl;
+    cout << "dijkstra: " << dijkstraSeconds / queries * 1e3 << " ms por consulta" << endl;
+    cout << "bidirectionalDijkstra: " << bidirectionalSeconds / queries * 1e3 << " ms por consulta" << endl;
+    cout << "aStar: " << aStarSeconds / queries * 1e3 << " ms por consulta" << endl;
+
+    delete[] sources;
+    delete[] targets;
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Mide cuánto tardan los bosques de cubrimiento mínimo sobre un CSRGraph: Kruskal con ordenamiento por
+// dígitos y Borůvka con 1 a varios hilos, frente a Graph::prim sobre las listas de adyacencia, y cuántas
+// uniones y búsquedas por segundo hace UnionFind.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/spanning_forests.cpp -o spanning_forests
+// Uso: ./spanning_forests [nodos] [aristas por nodo] [mayor peso] [máximo de hilos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <cstdint>
+#include <chrono>
+using namespace std;
+
+#include "graph.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int totalNodes = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int degree = argc > 2 ? atoi(argv[2]) : 4;
+    int maxWeight = argc > 3 ? atoi(argv[3]) : 1000;
+    int maxThreads = argc > 4 ? atoi(argv[4]) : 8;
+    totalNodes = totalNodes > 1 ? totalNodes : 2;
+    degree = degree > 0 ? degree : 1;
+    maxWeight = maxWeight > 0 ? maxWeight : 1;
+    maxThreads = maxThreads > 0 ? maxThreads : 1;
+
+    // Grafo no dirigido con un camino 1, 2, ..., totalNodes para que sea conexo, y degree aristas
+    // aleatorias más por nodo.
+    Graph graph(totalNodes, false, true, false);
+    unsigned seed = 12345;
+    long long edges = 0;
+    for (int node = 1; node <= totalNodes; node++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        if (node < totalNodes)
+        {
+            graph.addEdge(node, node + 1, 1 + (int)((seed >> 8) % maxWeight));
+            edges++;
+        }
+        for (int i = 0; i < degree; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            int adjacent = 1 + (int)((seed >> 4) % totalNodes);
+            seed = seed * 1664525u + 1013904223u;
+            if (adjacent != node)
+            {
+                graph.addEdge(node, adjacent, 1 + (int)((seed >> 8) % maxWeight));
+                edges++;
+            }
+        }
+    }
+    CSRGraph *csr = graph.toCSR();
+    cout << totalNodes << " nodos, " << edges << " aristas no dirigidas, pesos entre 1 y " << maxWeight << ", "
+         << ThreadPool::hardwareThreads() << " núcleos" << endl;
+
+    SpanningForest *kruskal = NULL;
+    double kruskalSeconds = measure([&]() { kruskal = MinimumSpanningForest::kruskal(*csr); });
+    assert(kruskal->isTree() && kruskal->size() == totalNodes - 1);
+    cout << "Kruskal: " << kruskalSeconds * 1e3 << " ms (costo " << kruskal->totalWeight() << ")" << endl;
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        SpanningForest *boruvka = NULL;
+        double seconds = measure([&]() { boruvka = MinimumSpanningForest::boruvka(*csr, threads); });
+        assert(boruvka->isTree() && boruvka->totalWeight() == kruskal->totalWeight());
+        cout << "Borůvka con " << threads << " hilos: " << seconds * 1e3 << " ms" << endl;
+        delete boruvka;
+    }
+
+    int *cost = NULL;
+    double primSeconds = measure([&]() { cost = graph.prim(1); });
+    // Graph::prim suma el costo en un int, así que sólo se compara si el peso total entra.
+    assert(cost != NULL && (kruskal->totalWeight() > INT32_MAX || *cost == kruskal->totalWeight()));
+    cout << "Graph::prim: " << primSeconds * 1e3 << " ms" << endl;
+
+    // Uniones de pares aleatorios y luego consultas de conexión, con caminos ya comprimidos.
+    UnionFind sets(totalNodes);
+    int merged = 0;
+    double uniteSeconds = measure([&]()
+    {
+        for (int i = 0; i < totalNodes; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            int first = 1 + (int)((seed >> 4) % totalNodes);
+            seed = seed * 1664525u + 1013904223u;
+            merged += sets.unite(first, 1 + (int)((seed >> 4) % totalNodes));
+        }
+    });
+    int connected = 0;
+    double findSeconds = measure([&]()
+    {
+        for (int i = 0; i < totalNodes; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            int first = 1 + (int)((seed >> 4) % totalNodes);
+            seed = seed * 1664525u + 1013904223u;
+            connected += sets.connected(first, 1 + (int)((seed >> 4) % totalNodes));
+        }
+    });
+    cout << "UnionFind: " << totalNodes / uniteSeconds / 1e6 << " M uniones/s (" << merged << " efectivas), "
+         << totalNodes / findSeconds / 1e6 << " M consultas/s (" << connected << " conectadas)" << endl;
+
+    delete cost;
+    delete kruskal;
+    delete csr;
+    return 0;
+}
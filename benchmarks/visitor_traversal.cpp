@@ -0,0 +1,167 @@
+// Mide los recorridos de Graph según cómo se les pasa el código del usuario: bfSearch y dfSearch con una lambda
+// (la versión template), con una std::function, y breadthFirstVisit y depthFirstVisit con un visitante que cuenta
+// las aristas examinadas o que corta el recorrido a la mitad. Se mide en modo de listas y en modo de matriz.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/visitor_traversal.cpp -o visitor_traversal
+// Uso: ./visitor_traversal [nodos en modo de listas] [aristas por nodo] [nodos en modo de matriz] [recorridos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "graph.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Visitante que cuenta los nodos descubiertos y las aristas examinadas.
+class CountingVisitor : public GraphVisitor
+{
+public:
+    long long nodes = 0;
+    long long edges = 0;
+
+    bool discoverNode(int, int)
+    {
+        nodes++;
+        return true;
+    }
+
+    bool examineEdge(int, int, int)
+    {
+        edges++;
+        return true;
+    }
+};
+
+/// @brief Visitante que termina el recorrido cuando descubrió limit nodos.
+class LimitVisitor : public GraphVisitor
+{
+public:
+    long long limit;
+    long long nodes = 0;
+
+    explicit LimitVisitor(long long limit) : limit(limit) {}
+
+    bool discoverNode(int, int)
+    {
+        return ++nodes < limit;
+    }
+};
+
+/// @brief Mide y muestra cada forma de recorrer el grafo, runs veces cada una.
+void traversals(Graph &graph, int totalNodes, int runs)
+{
+    long long lambdaSum = 0;
+    double lambdaSeconds = measure([&]()
+    {
+        for (int r = 0; r < runs; r++)
+        {
+            graph.bfSearch(1, [&](int node, int depth) { lambdaSum += node + depth; });
+        }
+    }) / runs;
+    long long functionSum = 0;
+    std::function<void(int, int)> function = [&](int node, int depth) { functionSum += node + depth; };
+    double functionSeconds = measure([&]()
+    {
+        for (int r = 0; r < runs; r++)
+        {
+            graph.bfSearch(1, function);
+        }
+    }) / runs;
+    assert(lambdaSum == functionSum);
+    CountingVisitor counting;
+    double visitorSeconds = measure([&]()
+    {
+        for (int r = 0; r < runs; r++)
+        {
+            graph.breadthFirstVisit(1, counting);
+        }
+    }) / runs;
+    LimitVisitor half(totalNodes / 2);
+    double halfSeconds = measure([&]()
+    {
+        for (int r = 0; r < runs; r++)
+        {
+            half.nodes = 0;
+            graph.breadthFirstVisit(1, half);
+        }
+    }) / runs;
+    assert(half.nodes <= totalNodes / 2 + 1);
+    cout << "  Anchura: lambda " << lambdaSeconds * 1e3 << " ms, std::function " << functionSeconds * 1e3
+         << " ms, visitante " << visitorSeconds * 1e3 << " ms (" << counting.nodes / runs << " nodos, "
+         << counting.edges / runs << " aristas), cortado a la mitad " << halfSeconds * 1e3 << " ms" << endl;
+
+    lambdaSum = 0;
+    lambdaSeconds = measure([&]()
+    {
+        for (int r = 0; r < runs; r++)
+        {
+            graph.dfSearch(1, [&](int node) { lambdaSum += node; });
+        }
+    }) / runs;
+    functionSum = 0;
+    std::function<void(int)> nodeFunction = [&](int node) { functionSum += node; };
+    functionSeconds = measure([&]()
+    {
+        for (int r = 0; r < runs; r++)
+        {
+            graph.dfSearch(1, nodeFunction);
+        }
+    }) / runs;
+    assert(lambdaSum == functionSum);
+    CountingVisitor depthCounting;
+    visitorSeconds = measure([&]()
+    {
+        for (int r = 0; r < runs; r++)
+        {
+            graph.depthFirstVisit(1, depthCounting);
+        }
+    }) / runs;
+    assert(depthCounting.nodes == counting.nodes && depthCounting.edges == counting.edges);
+    cout << "  Profundidad: lambda " << lambdaSeconds * 1e3 << " ms, std::function " << functionSeconds * 1e3
+         << " ms, visitante " << visitorSeconds * 1e3 << " ms" << endl;
+}
+
+int main(int argc, char **argv)
+{
+    int listNodes = argc > 1 ? atoi(argv[1]) : 300000;
+    int degree = argc > 2 ? atoi(argv[2]) : 8;
+    int denseNodes = argc > 3 ? atoi(argv[3]) : 4000;
+    int runs = argc > 4 ? atoi(argv[4]) : 5;
+    listNodes = listNodes > 1 ? listNodes : 2;
+    degree = degree > 0 ? degree : 1;
+    denseNodes = denseNodes > 1 ? denseNodes : 2;
+    runs = runs > 0 ? runs : 1;
+
+    // Grafos dirigidos aleatorios con un ciclo 1 -> 2 -> ... -> n -> 1, para que todos los nodos sean alcanzables.
+    unsigned seed = 12345;
+    int sizes[] = {listNodes, denseNodes};
+    for (int mode = 0; mode < 2; mode++)
+    {
+        int totalNodes = sizes[mode];
+        int edgesPerNode = mode == 0 ? degree : totalNodes / 8;
+        edgesPerNode = edgesPerNode > 0 ? edgesPerNode : 1;
+        Graph graph(totalNodes, true, true, mode == 1);
+        for (int u = 1; u <= totalNodes; u++)
+        {
+            graph.addEdge(u, u % totalNodes + 1);
+            for (int d = 1; d < edgesPerNode; d++)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                graph.addEdge(u, 1 + (int)((seed >> 4) % totalNodes), 1 + (int)((seed >> 8) % 100));
+            }
+        }
+        cout << (mode == 0 ? "Modo de listas: " : "Modo de matriz: ") << totalNodes << " nodos, hasta "
+             << (long long)totalNodes * edgesPerNode << " aristas" << endl;
+        traversals(graph, totalNodes, runs);
+    }
+    return 0;
+}
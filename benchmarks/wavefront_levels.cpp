@@ -0,0 +1,99 @@
+// Mide cuánto tarda Wavefront, el orden topológico por niveles con el camino crítico, con 1 a varios hilos,
+// frente al orden topológico con heap de CSRGraph::topoSort, en un grafo acíclico dirigido por capas.
+// Compilar desde la raíz del repositorio:
+//   g++ -std=c++14 -O2 -pthread -Iheaders benchmarks/wavefront_levels.cpp -o wavefront_levels
+// Uso: ./wavefront_levels [niveles] [nodos por nivel] [aristas por nodo] [máximo de hilos]
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <chrono>
+using namespace std;
+
+#include "wavefront.h"
+
+/// @brief Retorna los segundos que tarda en ejecutarse f().
+template <class F>
+double measure(F f)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int levels = argc > 1 ? atoi(argv[1]) : 10000;
+    int width = argc > 2 ? atoi(argv[2]) : 100;
+    int degree = argc > 3 ? atoi(argv[3]) : 4;
+    int maxThreads = argc > 4 ? atoi(argv[4]) : 8;
+    levels = levels > 0 ? levels : 1;
+    width = width > 0 ? width : 1;
+    degree = degree > 0 ? degree : 1;
+    maxThreads = maxThreads > 0 ? maxThreads : 1;
+
+    // El nodo i de la capa l es l * width + i + 1. Cada nodo apunta a degree nodos de la capa siguiente, y el
+    // primero de cada capa apunta al primero de la siguiente, así que el grafo tiene exactamente levels niveles.
+    int totalNodes = levels * width;
+    int totalEdges = (levels - 1) * width * degree;
+    int *from = new int[totalEdges > 0 ? totalEdges : 1];
+    int *to = new int[totalEdges > 0 ? totalEdges : 1];
+    int *weights = new int[totalEdges > 0 ? totalEdges : 1];
+    unsigned seed = 12345;
+    int edges = 0;
+    for (int l = 0; l + 1 < levels; l++)
+    {
+        for (int i = 0; i < width; i++)
+        {
+            for (int d = 0; d < degree; d++)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                from[edges] = l * width + i + 1;
+                to[edges] = (l + 1) * width + 1 + (i == 0 && d == 0 ? 0 : (int)((seed >> 4) % width));
+                weights[edges] = 1 + (int)((seed >> 8) % 100);
+                edges++;
+            }
+        }
+    }
+    CSRGraph graph(totalNodes, totalEdges, from, to, weights, true);
+    delete[] from;
+    delete[] to;
+    delete[] weights;
+    cout << totalNodes << " nodos, " << totalEdges << " aristas, " << levels << " niveles, "
+         << ThreadPool::hardwareThreads() << " núcleos" << endl;
+
+    // Camino más largo de referencia, recorriendo las capas en orden.
+    long long *longest = new long long[totalNodes + 1];
+    for (int u = 1; u <= totalNodes; u++)
+    {
+        longest[u] = 0;
+    }
+    long long critical = 0;
+    for (int u = 1; u <= totalNodes; u++)
+    {
+        for (int e = graph.edgesBegin(u); e < graph.edgesEnd(u); e++)
+        {
+            long long candidate = longest[u] + graph.weight(e);
+            longest[graph.target(e)] = candidate > longest[graph.target(e)] ? candidate : longest[graph.target(e)];
+        }
+        critical = longest[u] > critical ? longest[u] : critical;
+    }
+
+    List<int> *sorted = NULL;
+    double heapSeconds = measure([&]() { sorted = graph.topoSort(); });
+    assert(sorted->size() == totalNodes);
+    delete sorted;
+    cout << "CSRGraph::topoSort: " << heapSeconds * 1e3 << " ms" << endl;
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        Wavefront wavefront(graph, threads);
+        bool isAcyclic = false;
+        double seconds = measure([&]() { isAcyclic = wavefront.compute(); });
+        assert(isAcyclic && wavefront.totalLevels() == levels && wavefront.criticalPathLength() == critical);
+        cout << "Wavefront con " << threads << " hilos: " << seconds * 1e3 << " ms, camino crítico "
+             << wavefront.criticalPathLength() << endl;
+    }
+
+    delete[] longest;
+    return 0;
+}
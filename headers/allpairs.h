@@ -0,0 +1,274 @@
+#ifndef ALLPAIRS_H
+#define ALLPAIRS_H
+
+#ifdef __AVX2__
+#include <immintrin.h> // Para el núcleo min-plus con instrucciones vectoriales de 8 enteros.
+#endif
+
+#include "stack.h"
+#include "threadpool.h"
+
+/// @brief Implementa los caminos más cortos entre todos los pares de nodos con Floyd-Warshall por bloques.
+/// La matriz de distancias es contigua y se recorre en bloques de BLOCK x BLOCK que entran en caché: en cada
+/// ronda se actualiza el bloque diagonal, luego los bloques de su fila y su columna, y por último el resto de
+/// los bloques, que son independientes entre sí y se reparten entre los hilos. El núcleo de cada bloque es un
+/// producto min-plus cuyo ciclo interno es vectorial.
+/// Opcionalmente guarda el siguiente nodo de cada camino, para reconstruirlo.
+/// @note Precondición: los pesos de arista no son negativos y las distancias son menores a INFINITE.
+class AllPairsShortestPaths
+{
+private:
+    static const int BLOCK = 64;
+    /// @brief Distancia de los pares sin camino. Es la mitad del máximo para que sumar dos no desborde.
+    static const int INFINITE = INT32_MAX / 2;
+
+    int _totalNodes;
+    /// @brief Tamaño de cada fila de la matriz: totalNodes + 1 redondeado a múltiplo de BLOCK.
+    int _stride;
+    int _blocks;
+    int *_distances;
+    /// @brief Siguiente nodo del camino desde la fila hasta la columna, o NULL si no se guarda.
+    int *_nextHops;
+    /// @brief Cantidad de aristas de cada camino, que desempata los caminos de igual distancia.
+    /// Sin el desempate, las aristas de peso 0 podrían dejar ciclos entre los siguientes nodos.
+    int *_hops;
+
+    int *cell(int *matrix, int row, int column) const
+    {
+        return matrix + (size_t)row * _stride + column;
+    }
+
+    /// @brief Actualiza el bloque target con los caminos que pasan por los nodos del bloque k:
+    /// target[i][j] = min(target[i][j], left[i][k] + right[k][j]).
+    /// Con k en el ciclo externo es correcto aunque target sea left o right, como en Floyd-Warshall.
+    void relaxBlock(int targetRow, int targetColumn, int k)
+    {
+        int *nextHops = _nextHops;
+        for (int kk = k * BLOCK; kk < (k + 1) * BLOCK; kk++)
+        {
+            const int *right = cell(_distances, kk, targetColumn * BLOCK);
+            for (int i = targetRow * BLOCK; i < (targetRow + 1) * BLOCK; i++)
+            {
+                int left = *cell(_distances, i, kk);
+                if (left >= INFINITE)
+                {
+                    continue;
+                }
+                int *target = cell(_distances, i, targetColumn * BLOCK);
+                if (nextHops == NULL)
+                {
+                    minPlusRow(target, right, left);
+                }
+                else
+                {
+                    minPlusRow(target, right, left, cell(_hops, i, targetColumn * BLOCK), cell(_hops, kk, targetColumn * BLOCK),
+                               *cell(_hops, i, kk), cell(nextHops, i, targetColumn * BLOCK), *cell(nextHops, i, kk));
+                }
+            }
+        }
+    }
+
+    /// @brief target[j] = min(target[j], left + right[j]) para las BLOCK columnas del bloque.
+    static void minPlusRow(int *target, const int *right, int left)
+    {
+#ifdef __AVX2__
+        __m256i leftVector = _mm256_set1_epi32(left);
+        for (int j = 0; j < BLOCK; j += 8)
+        {
+            __m256i sum = _mm256_add_epi32(leftVector, _mm256_loadu_si256((const __m256i *)(right + j)));
+            __m256i current = _mm256_loadu_si256((const __m256i *)(target + j));
+            _mm256_storeu_si256((__m256i *)(target + j), _mm256_min_epi32(current, sum));
+        }
+#else
+        // Sin ramas, para que el compilador lo vectorice con el conjunto de instrucciones disponible.
+        for (int j = 0; j < BLOCK; j++)
+        {
+            int sum = left + right[j];
+            target[j] = sum < target[j] ? sum : target[j];
+        }
+#endif
+    }
+
+    /// @brief Igual que minPlusRow, comparando por distancia y luego por cantidad de aristas.
+    /// Donde el camino mejora, el siguiente nodo pasa a ser el del camino hacia k.
+    static void minPlusRow(int *target, const int *right, int left, int *targetHops, const int *rightHops, int leftHops,
+                           int *nextHops, int nextHopToK)
+    {
+#ifdef __AVX2__
+        __m256i leftVector = _mm256_set1_epi32(left);
+        __m256i leftHopsVector = _mm256_set1_epi32(leftHops);
+        __m256i nextVector = _mm256_set1_epi32(nextHopToK);
+        for (int j = 0; j < BLOCK; j += 8)
+        {
+            __m256i sum = _mm256_add_epi32(leftVector, _mm256_loadu_si256((const __m256i *)(right + j)));
+            __m256i hopsSum = _mm256_add_epi32(leftHopsVector, _mm256_loadu_si256((const __m256i *)(rightHops + j)));
+            __m256i current = _mm256_loadu_si256((const __m256i *)(target + j));
+            __m256i currentHops = _mm256_loadu_si256((const __m256i *)(targetHops + j));
+            __m256i improved = _mm256_or_si256(_mm256_cmpgt_epi32(current, sum),
+                                               _mm256_and_si256(_mm256_cmpeq_epi32(current, sum), _mm256_cmpgt_epi32(currentHops, hopsSum)));
+            _mm256_storeu_si256((__m256i *)(target + j), _mm256_blendv_epi8(current, sum, improved));
+            _mm256_storeu_si256((__m256i *)(targetHops + j), _mm256_blendv_epi8(currentHops, hopsSum, improved));
+            __m256i hops = _mm256_loadu_si256((const __m256i *)(nextHops + j));
+            _mm256_storeu_si256((__m256i *)(nextHops + j), _mm256_blendv_epi8(hops, nextVector, improved));
+        }
+#else
+        for (int j = 0; j < BLOCK; j++)
+        {
+            int sum = left + right[j];
+            int hopsSum = leftHops + rightHops[j];
+            bool improved = sum < target[j] || (sum == target[j] && hopsSum < targetHops[j]);
+            target[j] = improved ? sum : target[j];
+            targetHops[j] = improved ? hopsSum : targetHops[j];
+            nextHops[j] = improved ? nextHopToK : nextHops[j];
+        }
+#endif
+    }
+
+public:
+    /// @brief Crea la matriz sin aristas: la distancia de cada nodo a sí mismo es 0 y el resto no tiene camino.
+    /// @param withNextHops Indica si se guarda el siguiente nodo de cada camino, para poder usar path.
+    /// Requiere dos matrices más del mismo tamaño.
+    explicit AllPairsShortestPaths(int totalNodes, bool withNextHops)
+    {
+        _totalNodes = totalNodes;
+        _blocks = (totalNodes + 1 + BLOCK - 1) / BLOCK;
+        _stride = _blocks * BLOCK;
+        size_t cells = (size_t)_stride * _stride;
+        _distances = new int[cells];
+        _nextHops = withNextHops ? new int[cells] : NULL;
+        _hops = withNextHops ? new int[cells] : NULL;
+        for (size_t i = 0; i < cells; i++)
+        {
+            _distances[i] = INFINITE;
+        }
+        for (int i = 0; i < _stride; i++)
+        {
+            *cell(_distances, i, i) = 0;
+        }
+        if (_nextHops != NULL)
+        {
+            for (int i = 0; i < _stride; i++)
+            {
+                for (int j = 0; j < _stride; j++)
+                {
+                    *cell(_nextHops, i, j) = i == j ? j : 0;
+                    *cell(_hops, i, j) = i == j ? 0 : INFINITE;
+                }
+            }
+        }
+    }
+
+    ~AllPairsShortestPaths()
+    {
+        delete[] _distances;
+        delete[] _nextHops;
+        delete[] _hops;
+    }
+
+    int totalNodes() const
+    {
+        return _totalNodes;
+    }
+
+    /// @brief Agrega la arista. Si ya había una entre los mismos nodos, se queda con el menor peso.
+    void addEdge(int from, int to, int weight)
+    {
+        assert(from > 0 && from <= _totalNodes && to > 0 && to <= _totalNodes && weight >= 0);
+        if (weight < *cell(_distances, from, to))
+        {
+            *cell(_distances, from, to) = weight;
+            if (_nextHops != NULL)
+            {
+                *cell(_nextHops, from, to) = to;
+                *cell(_hops, from, to) = 1;
+            }
+        }
+    }
+
+    /// @brief Calcula las distancias entre todos los pares.
+    /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+    void solve(int threads)
+    {
+        ThreadPool pool(threads);
+        for (int k = 0; k < _blocks; k++)
+        {
+            relaxBlock(k, k, k);
+            // Los bloques de la fila y la columna de k sólo dependen del diagonal.
+            pool.parallelFor(0, 2 * _blocks, [&](int begin, int end, int)
+            {
+                for (int b = begin; b < end; b++)
+                {
+                    int other = b / 2;
+                    if (other != k && b % 2 == 0)
+                    {
+                        relaxBlock(k, other, k);
+                    }
+                    else if (other != k)
+                    {
+                        relaxBlock(other, k, k);
+                    }
+                }
+            }, 1);
+            // El resto sólo depende de la fila y la columna de k, que ya no cambian en esta ronda.
+            pool.parallelFor(0, _blocks * _blocks, [&](int begin, int end, int)
+            {
+                for (int b = begin; b < end; b++)
+                {
+                    int row = b / _blocks;
+                    int column = b % _blocks;
+                    if (row != k && column != k)
+                    {
+                        relaxBlock(row, column, k);
+                    }
+                }
+            }, 1);
+        }
+    }
+
+    /// @brief Retorna la distancia más corta entre los nodos, o INT32_MAX si no hay camino.
+    int distance(int from, int to) const
+    {
+        int value = _distances[(size_t)from * _stride + to];
+        return value >= INFINITE ? INT32_MAX : value;
+    }
+
+    /// @brief Retorna la fila de distancias desde el nodo dado, indexada por nodo de destino.
+    /// Los pares sin camino tienen un valor mayor o igual a INT32_MAX / 2.
+    const int *distancesFrom(int from) const
+    {
+        return _distances + (size_t)from * _stride;
+    }
+
+    /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro, comenzando desde el origen,
+    /// o un stack vacío si no hay camino.
+    /// Precondición: se creó con withNextHops en true.
+    Stack<int> *path(int from, int to) const
+    {
+        assert(_nextHops != NULL);
+        Stack<int> *result = new Stack<int>();
+        if (distance(from, to) == INT32_MAX)
+        {
+            return result;
+        }
+        int length = 1;
+        for (int node = from; node != to; node = _nextHops[(size_t)node * _stride + to])
+        {
+            length++;
+        }
+        int *nodes = new int[length];
+        int index = 0;
+        for (int node = from; node != to; node = _nextHops[(size_t)node * _stride + to])
+        {
+            nodes[index++] = node;
+        }
+        nodes[index] = to;
+        for (int i = length - 1; i >= 0; i--)
+        {
+            result->push(nodes[i]);
+        }
+        delete[] nodes;
+        return result;
+    }
+};
+
+#endif
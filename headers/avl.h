@@ -2,6 +2,7 @@
 #define AVL_H
 
 #include "list.h"
+#include "eytzinger.h"
 
 template <typename T>
 class AVL
@@ -38,6 +39,18 @@ public:
         return list;
     }
 
+    /// @brief Retorna un índice de búsqueda inmutable y contiguo con los elementos actuales del árbol.
+    /// El índice no depende del árbol, por lo que sigue siendo válido si el árbol cambia o se destruye.
+    EytzingerIndex<T> * freeze()
+    {
+        int size = countRec(rootNode);
+        T * sortedElements = new T[size];
+        toArrayRec(sortedElements, 0, rootNode);
+        EytzingerIndex<T> * index = new EytzingerIndex<T>(sortedElements, size);
+        delete[] sortedElements;
+        return index;
+    }
+
 private:
     class AVLNode
     {
@@ -62,6 +75,24 @@ private:
         }
     }
 
+    int countRec(const AVLNode * node)
+    {
+        return node != NULL ? 1 + countRec(node->leftNode) + countRec(node->rightNode) : 0;
+    }
+
+    /// @brief Copia en orden los elementos del subárbol al arreglo desde la posición dada.
+    /// Retorna la siguiente posición libre.
+    int toArrayRec(T * array, int index, const AVLNode * node)
+    {
+        if(node != NULL)
+        {
+            index = toArrayRec(array, index, node->leftNode);
+            array[index++] = node->data;
+            index = toArrayRec(array, index, node->rightNode);
+        }
+        return index;
+    }
+
     void destroyTree(AVLNode *treeNode)
     {
         if (treeNode != NULL)
@@ -0,0 +1,189 @@
+#ifndef BUCKETQUEUE_H
+#define BUCKETQUEUE_H
+
+/// @brief Implementa una cola de baldes (Dial) indexada sobre identificadores enteros de 1 a maxId,
+/// con prioridades enteras no negativas. El valor de prioridad menor es el más prioritario.
+/// Hay un balde por valor de prioridad, de forma circular, por lo que las prioridades de la cola
+/// deben estar siempre dentro de [c, c + maxSpan], siendo c la última prioridad quitada o una menor
+/// agregada después. En Dijkstra y Prim esto se cumple tomando maxSpan como el mayor peso de arista.
+/// Todas las operaciones son O(1), más el avance sobre baldes vacíos, acotado por maxSpan.
+/// Tiene la misma interfaz que IndexedPQueue.
+/// @note Como en el resto de las estructuras, no se utiliza el índice 0.
+class BucketQueue
+{
+private:
+    int _population;
+    int _maxId;
+    int _bucketCount;
+    /// @brief Cota inferior de la menor prioridad de la cola.
+    int _current;
+    int *_head;
+    /// @brief Listas doblemente enlazadas de identificadores por balde, sobre arreglos.
+    int *_next;
+    int *_previous;
+    /// @brief Prioridad de cada identificador, o -1 si no está en la cola.
+    int *_key;
+
+    int bucketIndex(int key) const
+    {
+        return key % _bucketCount;
+    }
+
+    void link(int id, int key)
+    {
+        int bucket = bucketIndex(key);
+        _key[id] = key;
+        _previous[id] = 0;
+        _next[id] = _head[bucket];
+        if (_head[bucket] != 0)
+        {
+            _previous[_head[bucket]] = id;
+        }
+        _head[bucket] = id;
+        if (key < _current)
+        {
+            _current = key;
+        }
+    }
+
+    void unlink(int id)
+    {
+        if (_previous[id] != 0)
+        {
+            _next[_previous[id]] = _next[id];
+        }
+        else
+        {
+            _head[bucketIndex(_key[id])] = _next[id];
+        }
+        if (_next[id] != 0)
+        {
+            _previous[_next[id]] = _previous[id];
+        }
+        _key[id] = -1;
+    }
+
+    /// @brief Avanza la cota inferior hasta el primer balde no vacío.
+    void advance()
+    {
+        while (_head[bucketIndex(_current)] == 0)
+        {
+            _current++;
+        }
+    }
+
+public:
+    /// @brief Crea una cola vacía para identificadores de 1 a maxId.
+    /// @param maxSpan Mayor diferencia posible entre dos prioridades de la cola.
+    explicit BucketQueue(int maxId, int maxSpan)
+    {
+        _population = 0;
+        _maxId = maxId;
+        _bucketCount = (maxSpan > 0 ? maxSpan : 0) + 1;
+        _current = 0;
+        _head = new int[_bucketCount];
+        _next = new int[_maxId + 1];
+        _previous = new int[_maxId + 1];
+        _key = new int[_maxId + 1];
+        for (int i = 0; i < _bucketCount; i++)
+        {
+            _head[i] = 0;
+        }
+        for (int i = 0; i <= _maxId; i++)
+        {
+            _key[i] = -1;
+        }
+    }
+
+    ~BucketQueue()
+    {
+        delete[] _head;
+        delete[] _next;
+        delete[] _previous;
+        delete[] _key;
+    }
+
+    /// @brief Agrega el identificador a la cola con la prioridad dada.
+    /// Precondición: el identificador no está en la cola y la prioridad no es negativa.
+    void enqueue(int id, int priority)
+    {
+        assert(id > 0 && id <= _maxId && !contains(id) && priority >= 0);
+        if (_population == 0)
+        {
+            _current = priority;
+        }
+        link(id, priority);
+        _population++;
+    }
+
+    /// @brief Disminuye la prioridad del identificador.
+    /// Precondición: el identificador está en la cola y la prioridad no es mayor a la actual.
+    void decreaseKey(int id, int priority)
+    {
+        assert(contains(id) && priority <= _key[id] && priority >= 0);
+        unlink(id);
+        link(id, priority);
+    }
+
+    /// @brief Agrega el identificador o, si ya está en la cola, disminuye su prioridad.
+    void enqueueOrDecreaseKey(int id, int priority)
+    {
+        if (contains(id))
+        {
+            decreaseKey(id, priority);
+        }
+        else
+        {
+            enqueue(id, priority);
+        }
+    }
+
+    /// @brief Retorna true si el identificador está en la cola.
+    bool contains(int id) const
+    {
+        return _key[id] != -1;
+    }
+
+    /// @brief Quita de la cola al primero.
+    /// Si la cola está vacía, no tiene efecto.
+    void dequeue()
+    {
+        if (!isEmpty())
+        {
+            advance();
+            unlink(_head[bucketIndex(_current)]);
+            _population--;
+        }
+    }
+
+    /// @brief Retorna el identificador más prioritario.
+    /// Precondición: La cola no está vacía.
+    int front()
+    {
+        assert(!isEmpty());
+        advance();
+        return _head[bucketIndex(_current)];
+    }
+
+    /// @brief Retorna la prioridad del identificador más prioritario.
+    /// Precondición: La cola no está vacía.
+    int frontPriority()
+    {
+        assert(!isEmpty());
+        advance();
+        return _current;
+    }
+
+    /// @brief Retorna el tamaño actual de la cola.
+    int size() const
+    {
+        return _population;
+    }
+
+    bool isEmpty() const
+    {
+        return _population == 0;
+    }
+};
+
+#endif
@@ -0,0 +1,235 @@
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+
+#include <atomic> // Para unir componentes desde varios hilos.
+
+#include "csrgraph.h"
+#include "threadpool.h"
+
+/// @brief Implementa el cálculo de componentes conexas sobre un grafo CSR, sin recursión,
+/// para que la profundidad del grafo no quede limitada por el tamaño de la pila.
+class ConnectedComponents
+{
+private:
+    /// @brief Cantidad de vecinos de cada nodo que se unen antes de buscar la componente más grande.
+    static const int SAMPLING_ROUNDS = 2;
+    /// @brief Cantidad de nodos que se muestrean para estimar la componente más grande.
+    static const int SAMPLE_SIZE = 1024;
+
+    /// @brief Une los árboles de ambos nodos colgando la raíz mayor de la menor con compare-and-swap.
+    /// Si otro hilo cambió la raíz en el medio, se reintenta desde los nuevos padres.
+    static void link(std::atomic<int> *parent, int first, int second)
+    {
+        int firstParent = parent[first].load(std::memory_order_relaxed);
+        int secondParent = parent[second].load(std::memory_order_relaxed);
+        while (firstParent != secondParent)
+        {
+            int high = firstParent > secondParent ? firstParent : secondParent;
+            int low = firstParent + secondParent - high;
+            int highParent = parent[high].load(std::memory_order_relaxed);
+            if (highParent == low)
+            {
+                break;
+            }
+            if (highParent == high && parent[high].compare_exchange_strong(highParent, low, std::memory_order_relaxed))
+            {
+                break;
+            }
+            firstParent = parent[parent[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+            secondParent = parent[low].load(std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Cuelga cada nodo directamente de su raíz.
+    static void compress(std::atomic<int> *parent, int totalNodes, ThreadPool &pool)
+    {
+        pool.parallelFor(1, totalNodes + 1, [parent](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                int node = parent[i].load(std::memory_order_relaxed);
+                while (parent[node].load(std::memory_order_relaxed) != node)
+                {
+                    node = parent[node].load(std::memory_order_relaxed);
+                }
+                parent[i].store(node, std::memory_order_relaxed);
+            }
+        });
+    }
+
+public:
+    /// @brief Calcula las componentes fuertemente conexas con Tarjan iterativo.
+    /// @param component Arreglo de totalNodes + 1 posiciones donde se guarda la componente de cada nodo,
+    /// numeradas desde 1 en orden topológico inverso: ninguna arista va de una componente a otra de número mayor.
+    /// @return La cantidad de componentes.
+    static int strong(const CSRGraph &graph, int *component)
+    {
+        int totalNodes = graph.totalNodes();
+        // Orden de descubrimiento de cada nodo (0 si no fue visitado) y el menor alcanzable desde su subárbol.
+        int *index = new int[totalNodes + 1];
+        int *lowLink = new int[totalNodes + 1];
+        // Próxima arista a recorrer de cada nodo en la pila de llamadas.
+        int *nextEdge = new int[totalNodes + 1];
+        bool *onStack = new bool[totalNodes + 1];
+        int *callStack = new int[totalNodes + 1];
+        int *componentStack = new int[totalNodes + 1];
+        for (int i = 0; i <= totalNodes; i++)
+        {
+            index[i] = 0;
+            onStack[i] = false;
+        }
+        int nextIndex = 1;
+        int components = 0;
+        for (int root = 1; root <= totalNodes; root++)
+        {
+            if (index[root] != 0)
+            {
+                continue;
+            }
+            int callSize = 0;
+            int componentSize = 0;
+            index[root] = lowLink[root] = nextIndex++;
+            nextEdge[root] = graph.edgesBegin(root);
+            onStack[root] = true;
+            callStack[callSize++] = root;
+            componentStack[componentSize++] = root;
+            while (callSize > 0)
+            {
+                int node = callStack[callSize - 1];
+                if (nextEdge[node] < graph.edgesEnd(node))
+                {
+                    int adjacentNode = graph.target(nextEdge[node]++);
+                    if (index[adjacentNode] == 0)
+                    {
+                        index[adjacentNode] = lowLink[adjacentNode] = nextIndex++;
+                        nextEdge[adjacentNode] = graph.edgesBegin(adjacentNode);
+                        onStack[adjacentNode] = true;
+                        callStack[callSize++] = adjacentNode;
+                        componentStack[componentSize++] = adjacentNode;
+                    }
+                    else if (onStack[adjacentNode] && index[adjacentNode] < lowLink[node])
+                    {
+                        lowLink[node] = index[adjacentNode];
+                    }
+                    continue;
+                }
+                // Se terminaron las aristas del nodo: si es raíz de una componente, se la quita de la pila.
+                callSize--;
+                if (lowLink[node] == index[node])
+                {
+                    components++;
+                    int member;
+                    do
+                    {
+                        member = componentStack[--componentSize];
+                        onStack[member] = false;
+                        component[member] = components;
+                    } while (member != node);
+                }
+                if (callSize > 0 && lowLink[node] < lowLink[callStack[callSize - 1]])
+                {
+                    lowLink[callStack[callSize - 1]] = lowLink[node];
+                }
+            }
+        }
+        delete[] index;
+        delete[] lowLink;
+        delete[] nextEdge;
+        delete[] onStack;
+        delete[] callStack;
+        delete[] componentStack;
+        return components;
+    }
+
+    /// @brief Calcula las componentes débilmente conexas (ignorando la dirección de las aristas) con varios hilos,
+    /// con Afforest: une cada nodo con sus primeros vecinos, estima por muestreo la componente más grande, y
+    /// recorre el resto de las aristas sólo desde los nodos que no quedaron en ella.
+    /// @param component Arreglo de totalNodes + 1 posiciones donde se guarda la componente de cada nodo,
+    /// identificada por el menor nodo que contiene.
+    /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+    /// @return La cantidad de componentes.
+    static int weak(const CSRGraph &graph, int *component, int threads)
+    {
+        int totalNodes = graph.totalNodes();
+        ThreadPool pool(threads);
+        std::atomic<int> *parent = new std::atomic<int>[totalNodes + 1];
+        pool.parallelFor(0, totalNodes + 1, [parent](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                parent[i].store(i, std::memory_order_relaxed);
+            }
+        });
+
+        for (int round = 0; round < SAMPLING_ROUNDS; round++)
+        {
+            pool.parallelFor(1, totalNodes + 1, [&](int begin, int end, int)
+            {
+                for (int i = begin; i < end; i++)
+                {
+                    if (graph.edgesBegin(i) + round < graph.edgesEnd(i))
+                    {
+                        link(parent, i, graph.target(graph.edgesBegin(i) + round));
+                    }
+                }
+            });
+            compress(parent, totalNodes, pool);
+        }
+
+        // Saltear la componente más grande sólo es correcto si cada arista se ve desde ambos extremos.
+        int largest = 0;
+        if (!graph.isDirected() && totalNodes > 0)
+        {
+            int *sample = new int[SAMPLE_SIZE];
+            unsigned int seed = 12345;
+            for (int i = 0; i < SAMPLE_SIZE; i++)
+            {
+                seed = seed * 1103515245u + 12345u;
+                sample[i] = parent[1 + (int)((seed >> 8) % (unsigned int)totalNodes)].load(std::memory_order_relaxed);
+            }
+            int bestCount = 0;
+            for (int i = 0; i < SAMPLE_SIZE; i++)
+            {
+                int count = 0;
+                for (int j = 0; j < SAMPLE_SIZE; j++)
+                {
+                    count += sample[j] == sample[i];
+                }
+                if (count > bestCount)
+                {
+                    bestCount = count;
+                    largest = sample[i];
+                }
+            }
+            delete[] sample;
+        }
+
+        pool.parallelFor(1, totalNodes + 1, [&](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                if (parent[i].load(std::memory_order_relaxed) == largest)
+                {
+                    continue;
+                }
+                int first = graph.isDirected() ? graph.edgesBegin(i) : graph.edgesBegin(i) + SAMPLING_ROUNDS;
+                for (int e = first; e < graph.edgesEnd(i); e++)
+                {
+                    link(parent, i, graph.target(e));
+                }
+            }
+        });
+        compress(parent, totalNodes, pool);
+
+        int components = 0;
+        for (int i = 1; i <= totalNodes; i++)
+        {
+            component[i] = parent[i].load(std::memory_order_relaxed);
+            components += component[i] == i;
+        }
+        delete[] parent;
+        return components;
+    }
+};
+
+#endif
@@ -0,0 +1,741 @@
+#ifndef COMPRESSEDGRAPH_H
+#define COMPRESSEDGRAPH_H
+
+#include <cstdlib> // Para agrandar los arreglos del Builder con realloc.
+#include <functional> // Para liberar los arreglos que no son del grafo.
+#include <new> // Para avisar con std::bad_alloc si realloc falla, como new.
+
+#include "csrgraph.h"
+#include "heap.h"
+#include "indexedpqueue.h"
+#include "list.h"
+#include "stack.h"
+#include "threadpool.h"
+
+/// @brief Implementa una vista inmutable y comprimida de un grafo, para grafos que no entran en memoria en CSR.
+/// Los adyacentes de cada nodo se ordenan y se guardan como diferencias con el anterior, cada una en un varint
+/// (7 bits por byte, con el bit alto indicando que sigue otro byte). Como los adyacentes suelen tener números
+/// cercanos, la mayoría de las aristas ocupa un byte. Los pesos se guardan aparte, sin comprimir, y no se
+/// guardan si todos valen 1.
+/// Los recorridos decodifican los adyacentes a medida que los leen, sin descomprimir el grafo.
+/// Se construye desde una vista CSR, o con un Builder a partir de las aristas agrupadas por origen sin
+/// pasar por CSR, y GraphIO lo puede guardar en un archivo y mapearlo en memoria.
+/// @note Los nodos son numerados desde 1 hasta la cantidad de nodos, como en Graph. Los índices de las
+/// aristas son long long, así que la cantidad de aristas no está limitada a un int.
+class CompressedGraph
+{
+private:
+    /// @brief Adyacente de una fila que se está por codificar.
+    class Arc
+    {
+    public:
+        int target;
+        int weight;
+    };
+
+    /// @brief Arreglo que crece a medida que se le agregan elementos, para el Builder.
+    /// Como sus elementos son tipos simples, se guarda con realloc: los bloques grandes se agrandan y se achican
+    /// reubicando páginas, sin copiarlas, así que no se tienen el arreglo viejo y el nuevo en memoria a la vez.
+    template <class E>
+    class Buffer
+    {
+    private:
+        void resize(size_t newCapacity)
+        {
+            E *newData = static_cast<E *>(std::realloc(data, (newCapacity > 0 ? newCapacity : 1) * sizeof(E)));
+            if (newData == NULL)
+            {
+                throw std::bad_alloc();
+            }
+            data = newData;
+            capacity = newCapacity;
+        }
+
+    public:
+        E *data;
+        size_t size;
+        size_t capacity;
+
+        Buffer() : data(NULL), size(0), capacity(0) {}
+
+        ~Buffer()
+        {
+            std::free(data);
+        }
+
+        /// @brief Agrega count posiciones al final y retorna la primera. La capacidad crece 1,5 veces.
+        E *extend(size_t count)
+        {
+            if (size + count > capacity)
+            {
+                size_t newCapacity = capacity > 0 ? capacity + capacity / 2 : 1024;
+                resize(newCapacity >= size + count ? newCapacity : size + count);
+            }
+            size += count;
+            return data + size - count;
+        }
+
+        void add(const E &element)
+        {
+            *extend(1) = element;
+        }
+
+        /// @brief Retorna el arreglo achicado al tamaño justo, que pasa a ser del llamador y se libera con free.
+        E *release()
+        {
+            resize(size);
+            E *result = data;
+            data = NULL;
+            size = capacity = 0;
+            return result;
+        }
+    };
+
+    int _totalNodes;
+    long long _totalEdges;
+    bool _isDirected;
+    /// @brief Posición del primer byte de los adyacentes de cada nodo. Tiene _totalNodes + 2 posiciones.
+    size_t *_byteOffsets;
+    /// @brief Índice de la primera arista de cada nodo, para ubicar sus pesos. Tiene _totalNodes + 2 posiciones.
+    long long *_edgeOffsets;
+    unsigned char *_bytes;
+    /// @brief Peso de cada arista en el orden de los adyacentes, o NULL si todas pesan 1.
+    int *_weights;
+    /// @brief Si los arreglos no se reservaron con new[], como los mapeados o los de un Builder, libera la
+    /// memoria que los contiene. Si no, está vacía.
+    std::function<void()> _release;
+
+    CompressedGraph() {}
+
+    static int varintSize(unsigned int value)
+    {
+        int size = 1;
+        while (value >= 0x80)
+        {
+            value >>= 7;
+            size++;
+        }
+        return size;
+    }
+
+    static unsigned char *writeVarint(unsigned char *position, unsigned int value)
+    {
+        while (value >= 0x80)
+        {
+            *position++ = (unsigned char)(value | 0x80);
+            value >>= 7;
+        }
+        *position++ = (unsigned char)value;
+        return position;
+    }
+
+    /// @brief Lee un varint y avanza la posición. La mayoría de los valores ocupa un byte, que se lee sin ciclo.
+    static unsigned int readVarint(const unsigned char *&position)
+    {
+        unsigned int value = *position++;
+        if (value < 0x80)
+        {
+            return value;
+        }
+        value &= 0x7F;
+        int shift = 7;
+        unsigned int byte;
+        do
+        {
+            byte = *position++;
+            value |= (byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte >= 0x80);
+        return value;
+    }
+
+    /// @brief El primer adyacente se guarda como diferencia con el nodo, que puede ser negativa: se codifica
+    /// en zigzag (0, -1, 1, -2, ... como 0, 1, 2, 3, ...) para que las diferencias chicas ocupen un byte.
+    static unsigned int zigzag(int value)
+    {
+        return ((unsigned int)value << 1) ^ (unsigned int)(value >> 31);
+    }
+
+    static int unzigzag(unsigned int value)
+    {
+        return (int)(value >> 1) ^ -(int)(value & 1);
+    }
+
+    /// @brief Ordena la fila por destino con un merge sort estable, para que las aristas repetidas conserven
+    /// su orden. Si la fila ya está ordenada, no hace nada.
+    /// @param scratch Arreglo auxiliar del mismo tamaño que la fila.
+    static void sortRow(Arc *row, Arc *scratch, int degree)
+    {
+        bool isSorted = true;
+        for (int i = 1; i < degree && isSorted; i++)
+        {
+            isSorted = row[i - 1].target <= row[i].target;
+        }
+        if (isSorted)
+        {
+            return;
+        }
+        Arc *source = row;
+        Arc *target = scratch;
+        for (int width = 1; width < degree; width *= 2)
+        {
+            for (int begin = 0; begin < degree; begin += 2 * width)
+            {
+                int middle = begin + width < degree ? begin + width : degree;
+                int end = middle + width < degree ? middle + width : degree;
+                int left = begin;
+                int right = middle;
+                for (int i = begin; i < end; i++)
+                {
+                    target[i] = right == end || (left < middle && source[left].target <= source[right].target) ? source[left++] : source[right++];
+                }
+            }
+            Arc *aux = source;
+            source = target;
+            target = aux;
+        }
+        for (int i = 0; source != row && i < degree; i++)
+        {
+            row[i] = source[i];
+        }
+    }
+
+    /// @brief Retorna la cantidad de bytes que ocupan los adyacentes ordenados de la fila del nodo.
+    static size_t encodedSize(const Arc *row, int degree, int node)
+    {
+        size_t size = 0;
+        int previous = node;
+        for (int i = 0; i < degree; i++)
+        {
+            size += i == 0 ? varintSize(zigzag(row[i].target - previous)) : varintSize((unsigned int)(row[i].target - previous));
+            previous = row[i].target;
+        }
+        return size;
+    }
+
+    static void encode(unsigned char *position, const Arc *row, int degree, int node)
+    {
+        int previous = node;
+        for (int i = 0; i < degree; i++)
+        {
+            position = writeVarint(position, i == 0 ? zigzag(row[i].target - previous) : (unsigned int)(row[i].target - previous));
+            previous = row[i].target;
+        }
+    }
+
+    /// @brief Copia la fila del nodo en row y la ordena. Retorna su cantidad de adyacentes.
+    static int loadRow(const CSRGraph &graph, int node, Arc *row, Arc *scratch)
+    {
+        int degree = 0;
+        for (int e = graph.edgesBegin(node); e < graph.edgesEnd(node); e++)
+        {
+            row[degree].target = graph.target(e);
+            row[degree++].weight = graph.weight(e);
+        }
+        sortRow(row, scratch, degree);
+        return degree;
+    }
+
+public:
+    /// @brief Construye el grafo comprimido a partir de las aristas agrupadas por origen, sin armar una vista
+    /// CSR ni guardar las aristas sin comprimir: sólo ocupa memoria el grafo comprimido y la fila del nodo actual.
+    /// Los orígenes deben llegar en orden creciente; las aristas de un mismo origen, en cualquier orden.
+    /// Para un grafo no dirigido, cada arista debe agregarse en ambos sentidos, como en CSRGraph.
+    class Builder
+    {
+    private:
+        bool _isDirected;
+        int _currentNode;
+        int _maxNode;
+        bool _isValid;
+        long long _totalEdges;
+        bool _isWeighted;
+        Buffer<size_t> _byteOffsets;
+        Buffer<long long> _edgeOffsets;
+        Buffer<unsigned char> _bytes;
+        /// @brief Pesos de las aristas codificadas. Queda vacío hasta que aparece un peso distinto de 1, para no
+        /// ocupar 4 bytes por arista en los grafos sin pesos.
+        Buffer<int> _weights;
+        Buffer<Arc> _row;
+        Buffer<Arc> _scratch;
+
+        /// @brief Codifica la fila del nodo actual y agrega el comienzo de los nodos hasta node inclusive.
+        void advance(int node)
+        {
+            int degree = (int)_row.size;
+            _scratch.size = 0;
+            _scratch.extend(_row.size);
+            sortRow(_row.data, _scratch.data, degree);
+            size_t size = encodedSize(_row.data, degree, _currentNode);
+            encode(_bytes.extend(size), _row.data, degree, _currentNode);
+            for (int i = 0; i < degree; i++)
+            {
+                if (_row.data[i].weight != 1 && !_isWeighted)
+                {
+                    int *weights = _weights.extend((size_t)(_totalEdges + i));
+                    for (long long e = 0; e < _totalEdges + i; weights[e++] = 1);
+                    _isWeighted = true;
+                }
+                if (_isWeighted)
+                {
+                    _weights.add(_row.data[i].weight);
+                }
+            }
+            _totalEdges += degree;
+            _row.size = 0;
+            while (_currentNode < node)
+            {
+                _currentNode++;
+                _byteOffsets.add(_bytes.size);
+                _edgeOffsets.add(_totalEdges);
+            }
+        }
+
+    public:
+        explicit Builder(bool isDirected) : _isDirected(isDirected), _currentNode(1), _maxNode(0), _isValid(true), _totalEdges(0), _isWeighted(false)
+        {
+            // Los nodos 0 y 1 comienzan en la posición 0.
+            _byteOffsets.add(0);
+            _byteOffsets.add(0);
+            _edgeOffsets.add(0);
+            _edgeOffsets.add(0);
+        }
+
+        /// @brief Agrega la arista. Retorna false, y el Builder deja de ser válido, si algún nodo es menor
+        /// que 1 o igual a INT32_MAX, o el origen es menor que el de la arista anterior.
+        /// El último nodo es INT32_MAX - 1 porque build agrega el comienzo del nodo siguiente.
+        bool addEdge(int from, int to, int weight = 1)
+        {
+            _isValid = _isValid && from >= _currentNode && to >= 1 && from < INT32_MAX && to < INT32_MAX;
+            if (!_isValid)
+            {
+                return false;
+            }
+            if (from > _currentNode)
+            {
+                advance(from);
+            }
+            Arc arc;
+            arc.target = to;
+            arc.weight = weight;
+            _row.add(arc);
+            _maxNode = from > _maxNode ? from : _maxNode;
+            _maxNode = to > _maxNode ? to : _maxNode;
+            return true;
+        }
+
+        /// @brief Retorna el grafo con las aristas agregadas. Luego, el Builder ya no se puede usar.
+        /// @param totalNodes Cantidad de nodos. Si es menor al mayor nodo agregado, se usa ese nodo.
+        /// @return El grafo, o NULL si alguna arista no fue válida o totalNodes es INT32_MAX.
+        CompressedGraph *build(int totalNodes = 0)
+        {
+            if (!_isValid || totalNodes == INT32_MAX)
+            {
+                return NULL;
+            }
+            totalNodes = totalNodes > _maxNode ? totalNodes : _maxNode;
+            advance(totalNodes + 1);
+            CompressedGraph *graph = new CompressedGraph();
+            graph->_totalNodes = totalNodes;
+            graph->_totalEdges = _totalEdges;
+            graph->_isDirected = _isDirected;
+            graph->_byteOffsets = _byteOffsets.release();
+            graph->_edgeOffsets = _edgeOffsets.release();
+            graph->_bytes = _bytes.release();
+            graph->_weights = _isWeighted ? _weights.release() : NULL;
+            // Los arreglos de Buffer se liberan con free en lugar de delete[].
+            size_t *byteOffsets = graph->_byteOffsets;
+            long long *edgeOffsets = graph->_edgeOffsets;
+            unsigned char *bytes = graph->_bytes;
+            int *weights = graph->_weights;
+            graph->_release = [byteOffsets, edgeOffsets, bytes, weights]()
+            {
+                std::free(byteOffsets);
+                std::free(edgeOffsets);
+                std::free(bytes);
+                std::free(weights);
+            };
+            return graph;
+        }
+    };
+
+    /// @brief Construye el grafo comprimido a partir de su vista CSR, en O(V + E log d), siendo d el mayor grado.
+    /// Cada fila se ordena en un arreglo auxiliar del hilo que la codifica, sin copiar el grafo.
+    /// @param threads Cantidad de hilos para codificar los adyacentes. Si es menor a 1, se usa la cantidad de núcleos.
+    explicit CompressedGraph(const CSRGraph &graph, int threads = 1)
+    {
+        _totalNodes = graph.totalNodes();
+        _totalEdges = graph.totalEdges();
+        _isDirected = graph.isDirected();
+        ThreadPool pool(threads);
+        int maxDegree = 1;
+        bool isWeighted = false;
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            maxDegree = graph.outDegree(u) > maxDegree ? graph.outDegree(u) : maxDegree;
+        }
+        for (int e = 0; e < _totalEdges && !isWeighted; e++)
+        {
+            isWeighted = graph.weight(e) != 1;
+        }
+        // Cada hilo usa una fila y su arreglo auxiliar del tamaño del mayor grado.
+        Arc *rows = new Arc[(size_t)pool.size() * 2 * maxDegree];
+
+        _byteOffsets = new size_t[_totalNodes + 2];
+        _edgeOffsets = new long long[_totalNodes + 2];
+        _byteOffsets[0] = _byteOffsets[1] = 0;
+        pool.parallelFor(1, _totalNodes + 1, [&](int begin, int end, int worker)
+        {
+            Arc *row = rows + (size_t)worker * 2 * maxDegree;
+            for (int u = begin; u < end; u++)
+            {
+                int degree = loadRow(graph, u, row, row + maxDegree);
+                _byteOffsets[u + 1] = encodedSize(row, degree, u);
+            }
+        });
+        for (int u = 0; u <= _totalNodes + 1; u++)
+        {
+            _edgeOffsets[u] = graph.edgesBegin(u);
+            _byteOffsets[u] += u > 1 ? _byteOffsets[u - 1] : 0;
+        }
+        _bytes = new unsigned char[_byteOffsets[_totalNodes + 1] > 0 ? _byteOffsets[_totalNodes + 1] : 1];
+        _weights = isWeighted ? new int[_totalEdges] : NULL;
+        // Las filas se vuelven a ordenar al codificarlas, para no guardar las filas ordenadas entre las dos pasadas.
+        pool.parallelFor(1, _totalNodes + 1, [&](int begin, int end, int worker)
+        {
+            Arc *row = rows + (size_t)worker * 2 * maxDegree;
+            for (int u = begin; u < end; u++)
+            {
+                int degree = loadRow(graph, u, row, row + maxDegree);
+                encode(_bytes + _byteOffsets[u], row, degree, u);
+                for (int i = 0; isWeighted && i < degree; i++)
+                {
+                    _weights[_edgeOffsets[u] + i] = row[i].weight;
+                }
+            }
+        });
+        delete[] rows;
+    }
+
+    /// @brief Crea el grafo sobre arreglos ya codificados, sin copiarlos, como los de un archivo mapeado en
+    /// memoria. El grafo nunca escribe en ellos.
+    /// @param weights Pesos de las aristas, o NULL si todas pesan 1.
+    /// @param release Función que libera los arreglos al destruir el grafo.
+    static CompressedGraph *view(int totalNodes, long long totalEdges, bool isDirected, const size_t *byteOffsets,
+                                 const long long *edgeOffsets, const unsigned char *bytes, const int *weights,
+                                 std::function<void()> release)
+    {
+        CompressedGraph *graph = new CompressedGraph();
+        graph->_totalNodes = totalNodes;
+        graph->_totalEdges = totalEdges;
+        graph->_isDirected = isDirected;
+        graph->_byteOffsets = const_cast<size_t *>(byteOffsets);
+        graph->_edgeOffsets = const_cast<long long *>(edgeOffsets);
+        graph->_bytes = const_cast<unsigned char *>(bytes);
+        graph->_weights = const_cast<int *>(weights);
+        graph->_release = release;
+        return graph;
+    }
+
+    ~CompressedGraph()
+    {
+        if (_release)
+        {
+            _release();
+        }
+        else
+        {
+            delete[] _byteOffsets;
+            delete[] _edgeOffsets;
+            delete[] _bytes;
+            delete[] _weights;
+        }
+    }
+
+    int totalNodes() const
+    {
+        return _totalNodes;
+    }
+
+    /// @brief Retorna la cantidad de aristas almacenadas. En un grafo no dirigido, cada arista cuenta dos veces.
+    long long totalEdges() const
+    {
+        return _totalEdges;
+    }
+
+    bool isDirected() const
+    {
+        return _isDirected;
+    }
+
+    int outDegree(int node) const
+    {
+        return (int)(_edgeOffsets[node + 1] - _edgeOffsets[node]);
+    }
+
+    /// @brief Retorna la cantidad de bytes de los adyacentes codificados.
+    size_t totalBytes() const
+    {
+        return _byteOffsets[_totalNodes + 1];
+    }
+
+    /// @brief Retorna la posición del primer byte de los adyacentes de cada nodo, con totalNodes + 2 posiciones.
+    const size_t *byteOffsets() const
+    {
+        return _byteOffsets;
+    }
+
+    /// @brief Retorna el índice de la primera arista de cada nodo, con totalNodes + 2 posiciones.
+    const long long *edgeOffsets() const
+    {
+        return _edgeOffsets;
+    }
+
+    const unsigned char *bytes() const
+    {
+        return _bytes;
+    }
+
+    /// @brief Retorna los pesos de las aristas en el orden de los adyacentes, o NULL si todas pesan 1.
+    const int *weights() const
+    {
+        return _weights;
+    }
+
+    /// @brief Indica si los adyacentes de cada nodo decodifican exactamente su cantidad de aristas en sus bytes,
+    /// en orden creciente y entre 1 y la cantidad de nodos. Sirve para validar un grafo leído de un archivo
+    /// antes de recorrerlo.
+    /// Precondición: los arreglos de índices son crecientes y terminan en totalBytes y totalEdges.
+    bool isValid() const
+    {
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            const unsigned char *position = _bytes + _byteOffsets[u];
+            const unsigned char *end = _bytes + _byteOffsets[u + 1];
+            long long previous = u;
+            for (long long edge = _edgeOffsets[u]; edge < _edgeOffsets[u + 1]; edge++)
+            {
+                // Se decodifica a mano para no leer más allá de la fila si el último byte indica que sigue otro.
+                unsigned long long value = 0;
+                int shift = 0;
+                unsigned int byte = 0x80;
+                while (byte >= 0x80 && position < end && shift < 35)
+                {
+                    byte = *position++;
+                    value |= (unsigned long long)(byte & 0x7F) << shift;
+                    shift += 7;
+                }
+                if (byte >= 0x80 || value > 0xFFFFFFFFULL)
+                {
+                    return false;
+                }
+                long long target = edge == _edgeOffsets[u] ? previous + unzigzag((unsigned int)value) : previous + (long long)value;
+                if (target < 1 || target > _totalNodes)
+                {
+                    return false;
+                }
+                previous = target;
+            }
+            if (position != end)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Retorna la cantidad de bytes que ocupa el grafo.
+    size_t memoryUsage() const
+    {
+        return sizeof(*this) + (size_t)(_totalNodes + 2) * (sizeof(size_t) + sizeof(long long)) + _byteOffsets[_totalNodes + 1] +
+               (_weights != NULL ? (size_t)_totalEdges * sizeof(int) : 0);
+    }
+
+    /// @brief Aplica f(adjacentNode, weight) a cada adyacente del nodo, de menor a mayor, decodificándolos
+    /// a medida que se recorren.
+    template <class F>
+    void forEachAdjacent(int node, F f) const
+    {
+        const unsigned char *position = _bytes + _byteOffsets[node];
+        long long edge = _edgeOffsets[node];
+        long long end = _edgeOffsets[node + 1];
+        if (edge == end)
+        {
+            return;
+        }
+        int target = node + unzigzag(readVarint(position));
+        f(target, _weights != NULL ? _weights[edge] : 1);
+        for (edge++; edge < end; edge++)
+        {
+            target += (int)readVarint(position);
+            f(target, _weights != NULL ? _weights[edge] : 1);
+        }
+    }
+
+    /// @brief Retorna la vista CSR descomprimida del grafo, o NULL si tiene más aristas de las que entran en un int.
+    CSRGraph *toCSR(int threads = 1) const
+    {
+        if (_totalEdges > INT32_MAX)
+        {
+            return NULL;
+        }
+        int *from = new int[_totalEdges > 0 ? _totalEdges : 1];
+        int *to = new int[_totalEdges > 0 ? _totalEdges : 1];
+        int *weights = new int[_totalEdges > 0 ? _totalEdges : 1];
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            int e = (int)_edgeOffsets[u];
+            forEachAdjacent(u, [&](int adjacentNode, int weight)
+            {
+                from[e] = u;
+                to[e] = adjacentNode;
+                weights[e++] = weight;
+            });
+        }
+        CSRGraph *csr = new CSRGraph(_totalNodes, (int)_totalEdges, from, to, weights, _isDirected, threads);
+        delete[] from;
+        delete[] to;
+        delete[] weights;
+        return csr;
+    }
+
+    /// @brief Realiza el recorrido por anchura del grafo, aplicándole a cada nodo
+    /// la función f(node, step) enviada por parámetro.
+    /// @param nodeFrom El nodo desde donde comienza la recorrida.
+    template <class F>
+    void bfSearch(int nodeFrom, F f) const
+    {
+        int *queue = new int[_totalNodes];
+        int *steps = new int[_totalNodes + 1];
+        bool *visitedNodes = new bool[_totalNodes + 1];
+        for (int i = 1; i <= _totalNodes; visitedNodes[i++] = false);
+        int head = 0;
+        int tail = 0;
+        queue[tail++] = nodeFrom;
+        steps[nodeFrom] = 0;
+        visitedNodes[nodeFrom] = true;
+        while (head < tail)
+        {
+            int node = queue[head++];
+            f(node, steps[node]);
+            forEachAdjacent(node, [&](int adjacentNode, int)
+            {
+                if (!visitedNodes[adjacentNode])
+                {
+                    visitedNodes[adjacentNode] = true;
+                    steps[adjacentNode] = steps[node] + 1;
+                    queue[tail++] = adjacentNode;
+                }
+            });
+        }
+        delete[] queue;
+        delete[] steps;
+        delete[] visitedNodes;
+    }
+
+    /// @brief Retorna una lista con el órden topológico de los nodos, ordenados
+    /// de menor a mayor en su numeración en lo posible.
+    /// Si el grafo contiene algún ciclo, retorna la una lista vacía.
+    /// Precondición: El grafo es dirigido.
+    List<int> *topoSort() const
+    {
+        List<int> *resultList = new List<int>();
+        if (!_isDirected)
+        {
+            return resultList;
+        }
+        int *nodesInDegree = new int[_totalNodes + 1];
+        for (int i = 1; i <= _totalNodes; nodesInDegree[i++] = 0);
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            forEachAdjacent(u, [&](int adjacentNode, int)
+            {
+                nodesInDegree[adjacentNode]++;
+            });
+        }
+        Heap<int, MinComparator<int> > ceroInDegreeNodesHeap(_totalNodes);
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            if (nodesInDegree[i] == 0)
+            {
+                ceroInDegreeNodesHeap.add(i);
+            }
+        }
+        int visitedNodesCount = 0;
+        while (!ceroInDegreeNodesHeap.isEmpty())
+        {
+            visitedNodesCount++;
+            int node = ceroInDegreeNodesHeap.top();
+            ceroInDegreeNodesHeap.removeTop();
+            resultList->add(node);
+            forEachAdjacent(node, [&](int adjacentNode, int)
+            {
+                if (--nodesInDegree[adjacentNode] == 0)
+                {
+                    ceroInDegreeNodesHeap.add(adjacentNode);
+                }
+            });
+        }
+        delete[] nodesInDegree;
+        if (visitedNodesCount < _totalNodes)
+        {
+            resultList->clear();
+        }
+        return resultList;
+    }
+
+    /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro, comenzando desde el origen.
+    /// Precondición: el grafo es ponderado con pesos de arista no negativos.
+    Stack<int> *dijkstra(int from, int to) const
+    {
+        Stack<int> *path = new Stack<int>();
+        bool *visitedNodes = new bool[_totalNodes + 1];
+        int *previousNode = new int[_totalNodes + 1];
+        int *fromCostTo = new int[_totalNodes + 1];
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            visitedNodes[i] = false;
+            previousNode[i] = 0;
+            fromCostTo[i] = INT32_MAX;
+        }
+        fromCostTo[from] = 0;
+        IndexedPQueue<int> unvisitedNodes(_totalNodes);
+        unvisitedNodes.enqueue(from, 0);
+        while (!unvisitedNodes.isEmpty())
+        {
+            int node = unvisitedNodes.front();
+            unvisitedNodes.dequeue();
+            visitedNodes[node] = true;
+            if (node == to)
+            {
+                break;
+            }
+            forEachAdjacent(node, [&](int adjacentNode, int weight)
+            {
+                if (!visitedNodes[adjacentNode] && fromCostTo[adjacentNode] > fromCostTo[node] + weight)
+                {
+                    previousNode[adjacentNode] = node;
+                    fromCostTo[adjacentNode] = fromCostTo[node] + weight;
+                    unvisitedNodes.enqueueOrDecreaseKey(adjacentNode, fromCostTo[adjacentNode]);
+                }
+            });
+        }
+        // Si se visitó el nodo To hay un camino.
+        if (visitedNodes[to])
+        {
+            path->push(to);
+            int node = to;
+            while (node != from)
+            {
+                node = previousNode[node];
+                path->push(node);
+            }
+        }
+        delete[] visitedNodes;
+        delete[] previousNode;
+        delete[] fromCostTo;
+        return path;
+    }
+};
+
+#endif
@@ -0,0 +1,739 @@
+#ifndef CONTRACTION_H
+#define CONTRACTION_H
+
+#include <fstream> // Para guardar y cargar la jerarquía en archivos binarios.
+
+#include "csrgraph.h"
+#include "indexedpqueue.h"
+#include "stack.h"
+
+/// @brief Implementa una jerarquía de contracción (contraction hierarchy) para responder muchas consultas
+/// de camino más corto sobre un grafo que no cambia.
+/// El preprocesamiento contrae los nodos de a uno, del menos al más importante: al quitar un nodo, agrega un
+/// atajo entre cada par de vecinos cuyo único camino más corto pasaba por él. Cada nodo recibe así un rango,
+/// y todo camino más corto tiene un equivalente que primero sube y luego baja de rango, por lo que las consultas
+/// son búsquedas bidireccionales que sólo suben, y exploran unos pocos cientos de nodos.
+/// Cada atajo guarda el nodo contraído que reemplaza, para poder desarmarlo en el camino original.
+/// @note Precondición: los pesos de arista no son negativos.
+class ContractionHierarchy
+{
+private:
+    /// @brief Arista de la jerarquía. Si es un atajo, middle es el nodo contraído que reemplaza; si no, es 0.
+    class Arc
+    {
+    public:
+        int node;
+        int weight;
+        int middle;
+        Arc() : node(0), weight(0), middle(0) {}
+        Arc(int node, int weight, int middle) : node(node), weight(weight), middle(middle) {}
+    };
+
+    /// @brief Tramo del camino entre dos nodos, que se desarma si es un atajo.
+    class Segment
+    {
+    public:
+        int from;
+        int to;
+        int middle;
+        Segment() : from(0), to(0), middle(0) {}
+        Segment(int from, int to, int middle) : from(from), to(to), middle(middle) {}
+    };
+
+    /// @brief Arreglo que crece según sea necesario.
+    template <class E>
+    class Buffer
+    {
+    public:
+        E *data;
+        int size;
+        int capacity;
+
+        Buffer() : data(NULL), size(0), capacity(0) {}
+
+        ~Buffer()
+        {
+            delete[] data;
+        }
+
+        void add(const E &element)
+        {
+            if (size == capacity)
+            {
+                capacity = capacity > 0 ? 2 * capacity : 4;
+                E *newData = new E[capacity];
+                for (int i = 0; i < size; i++)
+                {
+                    newData[i] = data[i];
+                }
+                delete[] data;
+                data = newData;
+            }
+            data[size++] = element;
+        }
+    };
+
+    /// @brief Cantidad máxima de nodos que asienta cada búsqueda de testigos. Si la búsqueda se corta antes
+    /// de encontrar un testigo se agrega un atajo de más, que no afecta a la correctitud.
+    static const int WITNESS_SETTLE_LIMIT = 500;
+    /// @brief Límite menor para las búsquedas que sólo estiman la importancia de un nodo, que son muchas más.
+    static const int SIMULATION_SETTLE_LIMIT = 50;
+    /// @brief Identifica los archivos de jerarquías ("CHG1").
+    static const int FILE_MAGIC = 0x31474843;
+    static const long long NO_PATH = 1LL << 62;
+
+    int _totalNodes;
+    /// @brief Orden de contracción de cada nodo: los de mayor rango son los más importantes.
+    int *_rank;
+    /// @brief Aristas hacia nodos de mayor rango, en formato CSR por nodo de origen.
+    int *_forwardOffsets;
+    Arc *_forwardArcs;
+    /// @brief Aristas desde nodos de mayor rango, en formato CSR por nodo de destino.
+    /// Arc::node es el origen de la arista.
+    int *_backwardOffsets;
+    Arc *_backwardArcs;
+
+    // Estado de las consultas, que se reutiliza marcando cada nodo con el número de consulta.
+    int _query;
+    int *_reached[2];
+    long long *_distance[2];
+    int *_previous[2];
+    IndexedPQueue<long long> *_queue[2];
+    int _settledNodes;
+
+    // Estado del preprocesamiento.
+    Buffer<Arc> *_outArcs;
+    Buffer<Arc> *_inArcs;
+    bool *_contracted;
+    int *_contractedNeighbors;
+    int _witnessQuery;
+    int *_witnessReached;
+    long long *_witnessDistance;
+    IndexedPQueue<long long> *_witnessQueue;
+
+    ContractionHierarchy()
+    {
+        _totalNodes = 0;
+        _rank = NULL;
+        _forwardOffsets = NULL;
+        _forwardArcs = NULL;
+        _backwardOffsets = NULL;
+        _backwardArcs = NULL;
+    }
+
+    /// @brief Agrega la arista o, si ya existía, se queda con el menor peso.
+    void addOrImproveArc(int from, int to, int weight, int middle)
+    {
+        Buffer<Arc> &out = _outArcs[from];
+        for (int i = 0; i < out.size; i++)
+        {
+            if (out.data[i].node == to)
+            {
+                if (weight < out.data[i].weight)
+                {
+                    out.data[i] = Arc(to, weight, middle);
+                    Buffer<Arc> &in = _inArcs[to];
+                    for (int j = 0; j < in.size; j++)
+                    {
+                        if (in.data[j].node == from)
+                        {
+                            in.data[j] = Arc(from, weight, middle);
+                        }
+                    }
+                }
+                return;
+            }
+        }
+        out.add(Arc(to, weight, middle));
+        _inArcs[to].add(Arc(from, weight, middle));
+    }
+
+    /// @brief Quita de la lista las aristas hacia o desde el nodo dado.
+    static void removeArcs(Buffer<Arc> &arcs, int node)
+    {
+        for (int i = 0; i < arcs.size; i++)
+        {
+            if (arcs.data[i].node == node)
+            {
+                arcs.data[i--] = arcs.data[--arcs.size];
+            }
+        }
+    }
+
+    /// @brief Calcula distancias desde el nodo dado sin pasar por el nodo excluido ni por nodos ya contraídos,
+    /// hasta superar la distancia límite o el máximo de nodos asentados.
+    void witnessSearch(int from, int excluded, long long limit, int settleLimit)
+    {
+        _witnessQuery++;
+        _witnessQueue->clear();
+        _witnessReached[from] = _witnessQuery;
+        _witnessDistance[from] = 0;
+        _witnessQueue->enqueue(from, 0);
+        int settled = 0;
+        while (!_witnessQueue->isEmpty() && settled < settleLimit)
+        {
+            int node = _witnessQueue->front();
+            long long distance = _witnessQueue->frontPriority();
+            _witnessQueue->dequeue();
+            settled++;
+            if (distance > limit)
+            {
+                break;
+            }
+            Buffer<Arc> &out = _outArcs[node];
+            for (int i = 0; i < out.size; i++)
+            {
+                int adjacentNode = out.data[i].node;
+                long long newDistance = distance + out.data[i].weight;
+                if (_contracted[adjacentNode] || adjacentNode == excluded)
+                {
+                    continue;
+                }
+                if (_witnessReached[adjacentNode] != _witnessQuery || newDistance < _witnessDistance[adjacentNode])
+                {
+                    _witnessReached[adjacentNode] = _witnessQuery;
+                    _witnessDistance[adjacentNode] = newDistance;
+                    _witnessQueue->enqueueOrDecreaseKey(adjacentNode, newDistance);
+                }
+            }
+        }
+    }
+
+    /// @brief Retorna la cantidad de atajos que requiere contraer el nodo y, si insert es true, los agrega.
+    int contract(int node, bool insert)
+    {
+        int shortcuts = 0;
+        Buffer<Arc> &in = _inArcs[node];
+        Buffer<Arc> &out = _outArcs[node];
+        for (int i = 0; i < in.size; i++)
+        {
+            int from = in.data[i].node;
+            if (_contracted[from])
+            {
+                continue;
+            }
+            long long limit = -1;
+            for (int j = 0; j < out.size; j++)
+            {
+                long long via = (long long)in.data[i].weight + out.data[j].weight;
+                if (!_contracted[out.data[j].node] && out.data[j].node != from && via > limit)
+                {
+                    limit = via;
+                }
+            }
+            if (limit < 0)
+            {
+                continue;
+            }
+            witnessSearch(from, node, limit, insert ? WITNESS_SETTLE_LIMIT : SIMULATION_SETTLE_LIMIT);
+            for (int j = 0; j < out.size; j++)
+            {
+                int to = out.data[j].node;
+                long long via = (long long)in.data[i].weight + out.data[j].weight;
+                // Los caminos de INT32_MAX o más se consideran inexistentes, como en distance, así que sus atajos
+                // no se agregan en lugar de truncar el peso.
+                if (_contracted[to] || to == from || via >= INT32_MAX)
+                {
+                    continue;
+                }
+                if (_witnessReached[to] != _witnessQuery || _witnessDistance[to] > via)
+                {
+                    shortcuts++;
+                    if (insert)
+                    {
+                        addOrImproveArc(from, to, (int)via, node);
+                    }
+                }
+            }
+        }
+        return shortcuts;
+    }
+
+    /// @brief Importancia del nodo: conviene contraer primero los que agregan menos atajos de los que quitan,
+    /// y repartir la contracción por todo el grafo penalizando a los nodos con vecinos ya contraídos.
+    int priority(int node)
+    {
+        int arcs = 0;
+        for (int i = 0; i < _inArcs[node].size; i++)
+        {
+            arcs += !_contracted[_inArcs[node].data[i].node];
+        }
+        for (int i = 0; i < _outArcs[node].size; i++)
+        {
+            arcs += !_contracted[_outArcs[node].data[i].node];
+        }
+        return 2 * contract(node, false) - arcs + _contractedNeighbors[node];
+    }
+
+    void updateNeighbor(int node, IndexedPQueue<int> &order)
+    {
+        if (!_contracted[node])
+        {
+            // Sólo se suma el nuevo vecino contraído: el resto se recalcula al sacar el nodo de la cola.
+            _contractedNeighbors[node]++;
+            int nodePriority = order.priority(node) + 1;
+            order.remove(node);
+            order.enqueue(node, nodePriority);
+        }
+    }
+
+    void build(const CSRGraph &graph)
+    {
+        _outArcs = new Buffer<Arc>[_totalNodes + 1];
+        _inArcs = new Buffer<Arc>[_totalNodes + 1];
+        _contracted = new bool[_totalNodes + 1];
+        _contractedNeighbors = new int[_totalNodes + 1];
+        _witnessReached = new int[_totalNodes + 1];
+        _witnessDistance = new long long[_totalNodes + 1];
+        _witnessQueue = new IndexedPQueue<long long>(_totalNodes);
+        _witnessQuery = 0;
+        for (int i = 0; i <= _totalNodes; i++)
+        {
+            _contracted[i] = false;
+            _contractedNeighbors[i] = 0;
+            _witnessReached[i] = 0;
+        }
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            for (int e = graph.edgesBegin(i); e < graph.edgesEnd(i); e++)
+            {
+                if (graph.target(e) != i)
+                {
+                    addOrImproveArc(i, graph.target(e), graph.weight(e), 0);
+                }
+            }
+        }
+
+        // Se contrae según la importancia, recalculándola al sacar cada nodo de la cola (actualización perezosa).
+        IndexedPQueue<int> order(_totalNodes);
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            order.enqueue(i, priority(i));
+        }
+        int nextRank = 0;
+        while (!order.isEmpty())
+        {
+            int node = order.front();
+            order.dequeue();
+            int nodePriority = priority(node);
+            if (!order.isEmpty() && nodePriority > order.frontPriority())
+            {
+                order.enqueue(node, nodePriority);
+                continue;
+            }
+            contract(node, true);
+            _contracted[node] = true;
+            _rank[node] = nextRank++;
+            // Las aristas del nodo contraído quedan sólo en sus listas, que ya no cambian,
+            // para que las búsquedas de testigos no las recorran.
+            for (int i = 0; i < _inArcs[node].size; i++)
+            {
+                removeArcs(_outArcs[_inArcs[node].data[i].node], node);
+                updateNeighbor(_inArcs[node].data[i].node, order);
+            }
+            for (int i = 0; i < _outArcs[node].size; i++)
+            {
+                removeArcs(_inArcs[_outArcs[node].data[i].node], node);
+                updateNeighbor(_outArcs[node].data[i].node, order);
+            }
+        }
+
+        // Cada arista quedó sólo en las listas del nodo de menor rango: hacia arriba en la directa o desde arriba en la inversa.
+        _forwardOffsets = new int[_totalNodes + 2];
+        _backwardOffsets = new int[_totalNodes + 2];
+        _forwardOffsets[0] = _forwardOffsets[1] = 0;
+        _backwardOffsets[0] = _backwardOffsets[1] = 0;
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            int forwardCount = 0;
+            int backwardCount = 0;
+            for (int j = 0; j < _outArcs[i].size; j++)
+            {
+                forwardCount += _rank[_outArcs[i].data[j].node] > _rank[i];
+            }
+            for (int j = 0; j < _inArcs[i].size; j++)
+            {
+                backwardCount += _rank[_inArcs[i].data[j].node] > _rank[i];
+            }
+            _forwardOffsets[i + 1] = _forwardOffsets[i] + forwardCount;
+            _backwardOffsets[i + 1] = _backwardOffsets[i] + backwardCount;
+        }
+        _forwardArcs = new Arc[_forwardOffsets[_totalNodes + 1] > 0 ? _forwardOffsets[_totalNodes + 1] : 1];
+        _backwardArcs = new Arc[_backwardOffsets[_totalNodes + 1] > 0 ? _backwardOffsets[_totalNodes + 1] : 1];
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            int forwardPosition = _forwardOffsets[i];
+            int backwardPosition = _backwardOffsets[i];
+            for (int j = 0; j < _outArcs[i].size; j++)
+            {
+                if (_rank[_outArcs[i].data[j].node] > _rank[i])
+                {
+                    _forwardArcs[forwardPosition++] = _outArcs[i].data[j];
+                }
+            }
+            for (int j = 0; j < _inArcs[i].size; j++)
+            {
+                if (_rank[_inArcs[i].data[j].node] > _rank[i])
+                {
+                    _backwardArcs[backwardPosition++] = _inArcs[i].data[j];
+                }
+            }
+        }
+
+        delete[] _outArcs;
+        delete[] _inArcs;
+        delete[] _contracted;
+        delete[] _contractedNeighbors;
+        delete[] _witnessReached;
+        delete[] _witnessDistance;
+        delete _witnessQueue;
+    }
+
+    void initQuery()
+    {
+        _query = 0;
+        _settledNodes = 0;
+        for (int d = 0; d < 2; d++)
+        {
+            _reached[d] = new int[_totalNodes + 1];
+            _distance[d] = new long long[_totalNodes + 1];
+            _previous[d] = new int[_totalNodes + 1];
+            _queue[d] = new IndexedPQueue<long long>(_totalNodes);
+            for (int i = 0; i <= _totalNodes; i++)
+            {
+                _reached[d][i] = 0;
+            }
+        }
+    }
+
+    /// @brief Busca desde ambos extremos sólo hacia nodos de mayor rango. Una dirección deja de buscar cuando
+    /// su menor distancia pendiente ya no mejora la mejor encontrada.
+    /// @return La distancia, o NO_PATH si no hay camino. meetingNode es el nodo de mayor rango del camino.
+    long long search(int from, int to, int &meetingNode)
+    {
+        if (++_query == INT32_MAX)
+        {
+            for (int d = 0; d < 2; d++)
+            {
+                for (int i = 0; i <= _totalNodes; i++)
+                {
+                    _reached[d][i] = 0;
+                }
+            }
+            _query = 1;
+        }
+        _settledNodes = 0;
+        int start[2] = {from, to};
+        for (int d = 0; d < 2; d++)
+        {
+            _queue[d]->clear();
+            _reached[d][start[d]] = _query;
+            _distance[d][start[d]] = 0;
+            _previous[d][start[d]] = 0;
+            _queue[d]->enqueue(start[d], 0);
+        }
+        long long best = NO_PATH;
+        meetingNode = 0;
+        while (true)
+        {
+            bool forwardActive = !_queue[0]->isEmpty() && _queue[0]->frontPriority() < best;
+            bool backwardActive = !_queue[1]->isEmpty() && _queue[1]->frontPriority() < best;
+            if (!forwardActive && !backwardActive)
+            {
+                break;
+            }
+            int d = forwardActive && (!backwardActive || _queue[0]->frontPriority() <= _queue[1]->frontPriority()) ? 0 : 1;
+            int node = _queue[d]->front();
+            long long distance = _queue[d]->frontPriority();
+            _queue[d]->dequeue();
+            _settledNodes++;
+            if (_reached[1 - d][node] == _query && distance + _distance[1 - d][node] < best)
+            {
+                best = distance + _distance[1 - d][node];
+                meetingNode = node;
+            }
+            const int *offsets = d == 0 ? _forwardOffsets : _backwardOffsets;
+            const Arc *arcs = d == 0 ? _forwardArcs : _backwardArcs;
+            for (int e = offsets[node]; e < offsets[node + 1]; e++)
+            {
+                int adjacentNode = arcs[e].node;
+                long long newDistance = distance + arcs[e].weight;
+                if (_reached[d][adjacentNode] != _query || newDistance < _distance[d][adjacentNode])
+                {
+                    _reached[d][adjacentNode] = _query;
+                    _distance[d][adjacentNode] = newDistance;
+                    _previous[d][adjacentNode] = node;
+                    _queue[d]->enqueueOrDecreaseKey(adjacentNode, newDistance);
+                }
+            }
+        }
+        return best;
+    }
+
+    /// @brief Retorna el atajo o arista entre los nodos, que está guardado en el de menor rango, o NULL si no existe.
+    const Arc *findArc(int from, int to) const
+    {
+        if (_rank[to] > _rank[from])
+        {
+            for (int e = _forwardOffsets[from]; e < _forwardOffsets[from + 1]; e++)
+            {
+                if (_forwardArcs[e].node == to)
+                {
+                    return &_forwardArcs[e];
+                }
+            }
+        }
+        else
+        {
+            for (int e = _backwardOffsets[to]; e < _backwardOffsets[to + 1]; e++)
+            {
+                if (_backwardArcs[e].node == from)
+                {
+                    return &_backwardArcs[e];
+                }
+            }
+        }
+        return NULL;
+    }
+
+    /// @brief Verifica que los arreglos leídos de un archivo formen una jerarquía recorrible: los rangos son una
+    /// permutación, las aristas van hacia nodos de mayor rango, y cada atajo tiene sus dos mitades y un nodo
+    /// intermedio de menor rango que sus extremos, para que desarmarlo siempre termine.
+    bool isValid() const
+    {
+        bool *rankUsed = new bool[_totalNodes > 0 ? _totalNodes : 1];
+        for (int i = 0; i < _totalNodes; i++)
+        {
+            rankUsed[i] = false;
+        }
+        bool isPermutation = true;
+        for (int i = 1; i <= _totalNodes && isPermutation; i++)
+        {
+            isPermutation = _rank[i] >= 0 && _rank[i] < _totalNodes && !rankUsed[_rank[i]];
+            if (isPermutation)
+            {
+                rankUsed[_rank[i]] = true;
+            }
+        }
+        delete[] rankUsed;
+        if (!isPermutation)
+        {
+            return false;
+        }
+        if (_forwardOffsets[0] != 0 || _forwardOffsets[1] != 0 || _backwardOffsets[0] != 0 || _backwardOffsets[1] != 0)
+        {
+            return false;
+        }
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            if (_forwardOffsets[i + 1] < _forwardOffsets[i] || _backwardOffsets[i + 1] < _backwardOffsets[i])
+            {
+                return false;
+            }
+        }
+        int forwardArcs = _forwardOffsets[_totalNodes + 1];
+        int backwardArcs = _backwardOffsets[_totalNodes + 1];
+        for (int e = 0; e < forwardArcs + backwardArcs; e++)
+        {
+            const Arc &arc = e < forwardArcs ? _forwardArcs[e] : _backwardArcs[e - forwardArcs];
+            if (arc.node < 1 || arc.node > _totalNodes || arc.middle < 0 || arc.middle > _totalNodes || arc.weight < 0)
+            {
+                return false;
+            }
+        }
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            for (int d = 0; d < 2; d++)
+            {
+                const int *offsets = d == 0 ? _forwardOffsets : _backwardOffsets;
+                const Arc *arcs = d == 0 ? _forwardArcs : _backwardArcs;
+                for (int e = offsets[i]; e < offsets[i + 1]; e++)
+                {
+                    int from = d == 0 ? i : arcs[e].node;
+                    int to = d == 0 ? arcs[e].node : i;
+                    int middle = arcs[e].middle;
+                    if (_rank[arcs[e].node] <= _rank[i])
+                    {
+                        return false;
+                    }
+                    if (middle != 0 && (_rank[middle] >= _rank[from] || _rank[middle] >= _rank[to] ||
+                                        findArc(from, middle) == NULL || findArc(middle, to) == NULL))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    template <class E>
+    static bool writeArray(std::ofstream &file, const E *data, int size)
+    {
+        file.write(reinterpret_cast<const char *>(data), (std::streamsize)sizeof(E) * size);
+        return file.good();
+    }
+
+    template <class E>
+    static bool readArray(std::ifstream &file, E *data, int size)
+    {
+        file.read(reinterpret_cast<char *>(data), (std::streamsize)sizeof(E) * size);
+        return file.good();
+    }
+
+public:
+    /// @brief Construye la jerarquía contrayendo todos los nodos del grafo.
+    explicit ContractionHierarchy(const CSRGraph &graph)
+    {
+        _totalNodes = graph.totalNodes();
+        _rank = new int[_totalNodes + 1];
+        _rank[0] = -1;
+        build(graph);
+        initQuery();
+    }
+
+    ~ContractionHierarchy()
+    {
+        delete[] _rank;
+        delete[] _forwardOffsets;
+        delete[] _forwardArcs;
+        delete[] _backwardOffsets;
+        delete[] _backwardArcs;
+        for (int d = 0; d < 2; d++)
+        {
+            delete[] _reached[d];
+            delete[] _distance[d];
+            delete[] _previous[d];
+            delete _queue[d];
+        }
+    }
+
+    int totalNodes() const
+    {
+        return _totalNodes;
+    }
+
+    /// @brief Retorna la cantidad de aristas de la jerarquía, incluidos los atajos.
+    int totalArcs() const
+    {
+        return _forwardOffsets[_totalNodes + 1] + _backwardOffsets[_totalNodes + 1];
+    }
+
+    /// @brief Retorna el rango del nodo: 0 para el primero contraído, totalNodes - 1 para el último.
+    int rank(int node) const
+    {
+        return _rank[node];
+    }
+
+    /// @brief Retorna la cantidad de nodos asentados en la última consulta.
+    int settledNodes() const
+    {
+        return _settledNodes;
+    }
+
+    /// @brief Retorna la distancia más corta entre los nodos, o INT32_MAX si no hay camino.
+    int distance(int from, int to)
+    {
+        int meetingNode;
+        long long best = search(from, to, meetingNode);
+        return best == NO_PATH || best >= INT32_MAX ? INT32_MAX : (int)best;
+    }
+
+    /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro, comenzando desde el origen,
+    /// o un stack vacío si no hay camino (como en distance, tampoco si mide INT32_MAX o más).
+    /// Los atajos se desarman en las aristas originales.
+    Stack<int> *shortestPath(int from, int to)
+    {
+        Stack<int> *path = new Stack<int>();
+        int meetingNode;
+        long long best = search(from, to, meetingNode);
+        if (best == NO_PATH || best >= INT32_MAX)
+        {
+            return path;
+        }
+        // Los nodos de la jerarquía desde el origen hasta el encuentro, y desde el encuentro hasta el destino.
+        Buffer<int> nodes;
+        for (int node = meetingNode; node != 0; node = _previous[0][node])
+        {
+            nodes.add(node);
+        }
+        for (int i = 0, j = nodes.size - 1; i < j; i++, j--)
+        {
+            int aux = nodes.data[i];
+            nodes.data[i] = nodes.data[j];
+            nodes.data[j] = aux;
+        }
+        for (int node = _previous[1][meetingNode]; node != 0; node = _previous[1][node])
+        {
+            nodes.add(node);
+        }
+
+        // Se desarman los atajos de atrás hacia adelante, para apilar primero el destino.
+        Buffer<Segment> pending;
+        for (int i = nodes.size - 1; i > 0; i--)
+        {
+            const Arc *arc = findArc(nodes.data[i - 1], nodes.data[i]);
+            assert(arc != NULL);
+            pending.add(Segment(nodes.data[i - 1], nodes.data[i], arc->middle));
+            while (pending.size > 0)
+            {
+                Segment segment = pending.data[--pending.size];
+                if (segment.middle == 0)
+                {
+                    path->push(segment.to);
+                }
+                else
+                {
+                    // isValid garantiza que las dos mitades existen y que el nodo intermedio tiene menor rango.
+                    pending.add(Segment(segment.from, segment.middle, findArc(segment.from, segment.middle)->middle));
+                    pending.add(Segment(segment.middle, segment.to, findArc(segment.middle, segment.to)->middle));
+                }
+            }
+        }
+        path->push(from);
+        return path;
+    }
+
+    /// @brief Guarda la jerarquía en un archivo binario. Retorna false si no se pudo escribir.
+    bool save(const char *fileName) const
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        int header[4] = {FILE_MAGIC, _totalNodes, _forwardOffsets[_totalNodes + 1], _backwardOffsets[_totalNodes + 1]};
+        return writeArray(file, header, 4) && writeArray(file, _rank, _totalNodes + 1) &&
+               writeArray(file, _forwardOffsets, _totalNodes + 2) && writeArray(file, _forwardArcs, header[2]) &&
+               writeArray(file, _backwardOffsets, _totalNodes + 2) && writeArray(file, _backwardArcs, header[3]);
+    }
+
+    /// @brief Carga una jerarquía guardada con save. Retorna NULL si el archivo no existe o no es válido.
+    static ContractionHierarchy *load(const char *fileName)
+    {
+        std::ifstream file(fileName, std::ios::binary);
+        int header[4];
+        if (!readArray(file, header, 4) || header[0] != FILE_MAGIC || header[1] < 0 || header[2] < 0 || header[3] < 0)
+        {
+            return NULL;
+        }
+        ContractionHierarchy *hierarchy = new ContractionHierarchy();
+        hierarchy->_totalNodes = header[1];
+        hierarchy->_rank = new int[header[1] + 1];
+        hierarchy->_forwardOffsets = new int[header[1] + 2];
+        hierarchy->_forwardArcs = new Arc[header[2] > 0 ? header[2] : 1];
+        hierarchy->_backwardOffsets = new int[header[1] + 2];
+        hierarchy->_backwardArcs = new Arc[header[3] > 0 ? header[3] : 1];
+        hierarchy->initQuery();
+        if (!readArray(file, hierarchy->_rank, header[1] + 1) ||
+            !readArray(file, hierarchy->_forwardOffsets, header[1] + 2) ||
+            !readArray(file, hierarchy->_forwardArcs, header[2]) ||
+            !readArray(file, hierarchy->_backwardOffsets, header[1] + 2) ||
+            !readArray(file, hierarchy->_backwardArcs, header[3]) ||
+            hierarchy->_forwardOffsets[header[1] + 1] != header[2] ||
+            hierarchy->_backwardOffsets[header[1] + 1] != header[3] || !hierarchy->isValid())
+        {
+            delete hierarchy;
+            return NULL;
+        }
+        return hierarchy;
+    }
+};
+
+#endif
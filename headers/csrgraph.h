@@ -0,0 +1,496 @@
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include <functional> // Para liberar los arreglos que no son del grafo.
+
+#include "heap.h"
+#include "indexedpqueue.h"
+#include "list.h"
+#include "stack.h"
+#include "threadpool.h"
+
+/// @brief Implementa una vista inmutable de un grafo en formato CSR (compressed sparse row).
+/// Las aristas que salen del nodo u son las posiciones [offsets[u], offsets[u+1]) de los
+/// arreglos de destinos y pesos, por lo que recorrer los adyacentes de un nodo es leer
+/// memoria contigua, sin punteros ni iteradores.
+/// @note Los nodos son numerados desde 1 hasta la cantidad de nodos, como en Graph.
+class CSRGraph
+{
+private:
+    int _totalNodes;
+    int _totalEdges;
+    bool _isDirected;
+    /// @brief Índice de la primera arista de cada nodo. Tiene _totalNodes + 2 posiciones.
+    int *_offsets;
+    int *_targets;
+    int *_weights;
+    /// @brief Si los arreglos no son del grafo, libera la memoria que los contiene. Si no, está vacía.
+    std::function<void()> _release;
+
+    CSRGraph() {}
+
+    /// @brief Ordena las aristas por origen con un counting sort estable y paralelo en dos niveles.
+    /// Los nodos se reparten en un rango contiguo por hilo. Primero cada hilo cuenta cuántas aristas de su
+    /// tramo del arreglo caen en cada rango, y las agrupa por rango en un arreglo de índices; luego cada hilo
+    /// cuenta y ubica las aristas de su rango de nodos, usando _offsets como contador y cursor.
+    /// Los contadores ocupan hilos * hilos enteros en lugar de uno por nodo y por tramo, así que todos los
+    /// hilos trabajan aunque el grafo tenga muchos nodos y pocas aristas por nodo.
+    void build(const int *from, const int *to, const int *weights, int threads)
+    {
+        ThreadPool pool(threads);
+        int parts = pool.size();
+        size_t nodesPerRange = ((size_t)_totalNodes + parts - 1) / parts;
+        nodesPerRange = nodesPerRange > 0 ? nodesPerRange : 1;
+        // rangeCounts[p][r] es la cantidad de aristas del tramo p que salen de nodos del rango r,
+        // y luego la posición en byRange de la primera de ellas.
+        int *rangeCounts = new int[(size_t)parts * parts];
+        int *rangeBegin = new int[parts + 1];
+        int *byRange = new int[_totalEdges > 0 ? _totalEdges : 1];
+
+        pool.parallelFor(0, parts, [&](int begin, int end, int)
+        {
+            for (int part = begin; part < end; part++)
+            {
+                int *partCounts = rangeCounts + (size_t)part * parts;
+                for (int range = 0; range < parts; range++)
+                {
+                    partCounts[range] = 0;
+                }
+                size_t last = (size_t)(part + 1) * _totalEdges / parts;
+                for (size_t i = (size_t)part * _totalEdges / parts; i < last; i++)
+                {
+                    partCounts[(from[i] - 1) / nodesPerRange]++;
+                }
+            }
+        }, 1);
+
+        // Las aristas quedan agrupadas por rango y, dentro de cada rango, en el orden del arreglo.
+        int position = 0;
+        for (int range = 0; range < parts; range++)
+        {
+            rangeBegin[range] = position;
+            for (int part = 0; part < parts; part++)
+            {
+                int count = rangeCounts[(size_t)part * parts + range];
+                rangeCounts[(size_t)part * parts + range] = position;
+                position += count;
+            }
+        }
+        rangeBegin[parts] = position;
+
+        pool.parallelFor(0, parts, [&](int begin, int end, int)
+        {
+            for (int part = begin; part < end; part++)
+            {
+                int *partPositions = rangeCounts + (size_t)part * parts;
+                size_t last = (size_t)(part + 1) * _totalEdges / parts;
+                for (size_t i = (size_t)part * _totalEdges / parts; i < last; i++)
+                {
+                    byRange[partPositions[(from[i] - 1) / nodesPerRange]++] = (int)i;
+                }
+            }
+        }, 1);
+
+        // Las aristas de u van en [_offsets[u], _offsets[u+1]). Mientras se ubican, _offsets[u+1] es la próxima
+        // posición libre de u, y al terminar queda en el final de u, que es el comienzo de u + 1.
+        _offsets[0] = 0;
+        _offsets[1] = 0;
+        pool.parallelFor(0, parts, [&](int begin, int end, int)
+        {
+            for (int range = begin; range < end; range++)
+            {
+                size_t firstNode = 1 + (size_t)range * nodesPerRange;
+                size_t lastNode = firstNode + nodesPerRange < (size_t)_totalNodes + 1 ? firstNode + nodesPerRange : (size_t)_totalNodes + 1;
+                for (size_t u = firstNode; u < lastNode; u++)
+                {
+                    _offsets[u + 1] = 0;
+                }
+                for (int i = rangeBegin[range]; i < rangeBegin[range + 1]; i++)
+                {
+                    _offsets[from[byRange[i]] + 1]++;
+                }
+                int next = rangeBegin[range];
+                for (size_t u = firstNode; u < lastNode; u++)
+                {
+                    int degree = _offsets[u + 1];
+                    _offsets[u + 1] = next;
+                    next += degree;
+                }
+                for (int i = rangeBegin[range]; i < rangeBegin[range + 1]; i++)
+                {
+                    int edge = byRange[i];
+                    int edgePosition = _offsets[from[edge] + 1]++;
+                    _targets[edgePosition] = to[edge];
+                    _weights[edgePosition] = weights != NULL ? weights[edge] : 1;
+                }
+            }
+        }, 1);
+
+        delete[] rangeCounts;
+        delete[] rangeBegin;
+        delete[] byRange;
+    }
+
+public:
+    /// @brief Construye el grafo a partir de un arreglo de aristas, en O(V + E).
+    /// Para un grafo no dirigido, cada arista debe figurar en ambos sentidos, como en Graph.
+    /// Las aristas de cada nodo conservan el orden del arreglo.
+    /// @param totalNodes Cantidad de nodos.
+    /// @param totalEdges Cantidad de aristas de los arreglos.
+    /// @param from Nodo de origen de cada arista, desde la posición 0.
+    /// @param to Nodo de destino de cada arista.
+    /// @param weights Peso de cada arista, o NULL si todas pesan 1.
+    /// @param isDirected Indica si el grafo es dirigido.
+    /// @param threads Cantidad de hilos para ordenar las aristas.
+    explicit CSRGraph(int totalNodes, int totalEdges, const int *from, const int *to, const int *weights, bool isDirected, int threads = 1)
+    {
+        _totalNodes = totalNodes;
+        _totalEdges = totalEdges;
+        _isDirected = isDirected;
+        _offsets = new int[_totalNodes + 2];
+        _targets = new int[_totalEdges > 0 ? _totalEdges : 1];
+        _weights = new int[_totalEdges > 0 ? _totalEdges : 1];
+        build(from, to, weights, threads);
+    }
+
+    /// @brief Crea el grafo sobre arreglos CSR ya construidos, sin copiarlos, como los de un archivo
+    /// mapeado en memoria. El grafo nunca escribe en ellos.
+    /// @param offsets Índice de la primera arista de cada nodo, con totalNodes + 2 posiciones.
+    /// @param release Función que libera los arreglos al destruir el grafo.
+    static CSRGraph *view(int totalNodes, int totalEdges, const int *offsets, const int *targets, const int *weights,
+                          bool isDirected, std::function<void()> release)
+    {
+        CSRGraph *graph = new CSRGraph();
+        graph->_totalNodes = totalNodes;
+        graph->_totalEdges = totalEdges;
+        graph->_isDirected = isDirected;
+        graph->_offsets = const_cast<int *>(offsets);
+        graph->_targets = const_cast<int *>(targets);
+        graph->_weights = const_cast<int *>(weights);
+        graph->_release = release;
+        return graph;
+    }
+
+    ~CSRGraph()
+    {
+        if (_release)
+        {
+            _release();
+        }
+        else
+        {
+            delete[] _offsets;
+            delete[] _targets;
+            delete[] _weights;
+        }
+    }
+
+    int totalNodes() const
+    {
+        return _totalNodes;
+    }
+
+    /// @brief Retorna la cantidad de aristas almacenadas. En un grafo no dirigido, cada arista cuenta dos veces.
+    int totalEdges() const
+    {
+        return _totalEdges;
+    }
+
+    bool isDirected() const
+    {
+        return _isDirected;
+    }
+
+    /// @brief Retorna el índice de la primera arista que sale del nodo.
+    int edgesBegin(int node) const
+    {
+        return _offsets[node];
+    }
+
+    /// @brief Retorna el índice siguiente a la última arista que sale del nodo.
+    int edgesEnd(int node) const
+    {
+        return _offsets[node + 1];
+    }
+
+    int outDegree(int node) const
+    {
+        return _offsets[node + 1] - _offsets[node];
+    }
+
+    /// @brief Retorna el nodo destino de la arista de índice dado.
+    int target(int edge) const
+    {
+        return _targets[edge];
+    }
+
+    int weight(int edge) const
+    {
+        return _weights[edge];
+    }
+
+    /// @brief Retorna el arreglo de índices de la primera arista de cada nodo, con totalNodes + 2 posiciones.
+    const int *offsets() const
+    {
+        return _offsets;
+    }
+
+    /// @brief Retorna el arreglo de destinos de las aristas, con totalEdges posiciones.
+    const int *targets() const
+    {
+        return _targets;
+    }
+
+    const int *weights() const
+    {
+        return _weights;
+    }
+
+    /// @brief Retorna la cantidad de bytes que ocupan los arreglos del grafo.
+    size_t memoryUsage() const
+    {
+        return sizeof(*this) + (size_t)(_totalNodes + 2) * sizeof(int) + (size_t)_totalEdges * 2 * sizeof(int);
+    }
+
+    /// @brief Retorna un nuevo grafo con todas las aristas invertidas, que guarda para cada nodo
+    /// sus aristas incidentes. Si el grafo no es dirigido, el resultado es una copia.
+    /// @param threads Cantidad de hilos para construirlo.
+    CSRGraph *transpose(int threads = 1) const
+    {
+        int *from = new int[_totalEdges > 0 ? _totalEdges : 1];
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            for (int e = _offsets[u]; e < _offsets[u + 1]; e++)
+            {
+                from[e] = u;
+            }
+        }
+        CSRGraph *reverse = new CSRGraph(_totalNodes, _totalEdges, _targets, from, _weights, _isDirected, threads);
+        delete[] from;
+        return reverse;
+    }
+
+    /// @brief Realiza el recorrido por anchura del grafo, aplicándole a cada nodo
+    /// la función f(node, step) enviada por parámetro.
+    /// @param nodeFrom El nodo desde donde comienza la recorrida.
+    template <class F>
+    void bfSearch(int nodeFrom, F f) const
+    {
+        // La cola es un arreglo, porque cada nodo se agrega a lo sumo una vez.
+        int *queue = new int[_totalNodes];
+        int *steps = new int[_totalNodes + 1];
+        bool *visitedNodes = new bool[_totalNodes + 1];
+        for (int i = 1; i <= _totalNodes; visitedNodes[i++] = false);
+        int head = 0;
+        int tail = 0;
+        queue[tail++] = nodeFrom;
+        steps[nodeFrom] = 0;
+        visitedNodes[nodeFrom] = true;
+        while (head < tail)
+        {
+            int node = queue[head++];
+            f(node, steps[node]);
+            for (int e = _offsets[node]; e < _offsets[node + 1]; e++)
+            {
+                int adjacentNode = _targets[e];
+                if (!visitedNodes[adjacentNode])
+                {
+                    visitedNodes[adjacentNode] = true;
+                    steps[adjacentNode] = steps[node] + 1;
+                    queue[tail++] = adjacentNode;
+                }
+            }
+        }
+        delete[] queue;
+        delete[] steps;
+        delete[] visitedNodes;
+    }
+
+    /// @brief Realiza el recorrido en profundidad del grafo con una pila explícita, aplicándole a cada
+    /// nodo la función f(node) en el mismo orden que el recorrido recursivo.
+    template <class F>
+    void dfSearch(int nodeFrom, F f) const
+    {
+        // Por cada nodo de la pila se guarda la próxima arista a explorar.
+        int *nodesStack = new int[_totalNodes];
+        int *nextEdge = new int[_totalNodes];
+        bool *visitedNodes = new bool[_totalNodes + 1];
+        for (int i = 1; i <= _totalNodes; visitedNodes[i++] = false);
+        int top = 0;
+        visitedNodes[nodeFrom] = true;
+        f(nodeFrom);
+        nodesStack[top] = nodeFrom;
+        nextEdge[top++] = _offsets[nodeFrom];
+        while (top > 0)
+        {
+            int node = nodesStack[top - 1];
+            if (nextEdge[top - 1] == _offsets[node + 1])
+            {
+                top--;
+                continue;
+            }
+            int adjacentNode = _targets[nextEdge[top - 1]++];
+            if (!visitedNodes[adjacentNode])
+            {
+                visitedNodes[adjacentNode] = true;
+                f(adjacentNode);
+                nodesStack[top] = adjacentNode;
+                nextEdge[top++] = _offsets[adjacentNode];
+            }
+        }
+        delete[] nodesStack;
+        delete[] nextEdge;
+        delete[] visitedNodes;
+    }
+
+    /// @brief Retorna una lista con el órden topológico de los nodos, ordenados
+    /// de menor a mayor en su numeración en lo posible.
+    /// Si el grafo contiene algún ciclo, retorna la una lista vacía.
+    /// Precondición: El grafo es dirigido.
+    List<int> *topoSort() const
+    {
+        List<int> *resultList = new List<int>();
+        if (!_isDirected)
+        {
+            return resultList;
+        }
+        int *nodesInDegree = new int[_totalNodes + 1];
+        for (int i = 1; i <= _totalNodes; nodesInDegree[i++] = 0);
+        for (int e = 0; e < _totalEdges; e++)
+        {
+            nodesInDegree[_targets[e]]++;
+        }
+        Heap<int, MinComparator<int> > ceroInDegreeNodesHeap(_totalNodes);
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            if (nodesInDegree[i] == 0)
+            {
+                ceroInDegreeNodesHeap.add(i);
+            }
+        }
+        int visitedNodesCount = 0;
+        while (!ceroInDegreeNodesHeap.isEmpty())
+        {
+            visitedNodesCount++;
+            int node = ceroInDegreeNodesHeap.top();
+            ceroInDegreeNodesHeap.removeTop();
+            resultList->add(node);
+            for (int e = _offsets[node]; e < _offsets[node + 1]; e++)
+            {
+                if (--nodesInDegree[_targets[e]] == 0)
+                {
+                    ceroInDegreeNodesHeap.add(_targets[e]);
+                }
+            }
+        }
+        delete[] nodesInDegree;
+        if (visitedNodesCount < _totalNodes)
+        {
+            resultList->clear();
+        }
+        return resultList;
+    }
+
+    /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro, comenzando desde el origen.
+    /// Precondición: el grafo es ponderado con pesos de arista no negativos.
+    Stack<int> *dijkstra(int from, int to) const
+    {
+        Stack<int> *path = new Stack<int>();
+        bool *visitedNodes = new bool[_totalNodes + 1];
+        int *previousNode = new int[_totalNodes + 1];
+        int *fromCostTo = new int[_totalNodes + 1];
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            visitedNodes[i] = false;
+            previousNode[i] = 0;
+            fromCostTo[i] = INT32_MAX;
+        }
+        fromCostTo[from] = 0;
+        IndexedPQueue<int> unvisitedNodes(_totalNodes);
+        unvisitedNodes.enqueue(from, 0);
+        while (!unvisitedNodes.isEmpty())
+        {
+            int node = unvisitedNodes.front();
+            unvisitedNodes.dequeue();
+            visitedNodes[node] = true;
+            if (node == to)
+            {
+                break;
+            }
+            for (int e = _offsets[node]; e < _offsets[node + 1]; e++)
+            {
+                int adjacentNode = _targets[e];
+                if (!visitedNodes[adjacentNode] && fromCostTo[adjacentNode] > fromCostTo[node] + _weights[e])
+                {
+                    previousNode[adjacentNode] = node;
+                    fromCostTo[adjacentNode] = fromCostTo[node] + _weights[e];
+                    unvisitedNodes.enqueueOrDecreaseKey(adjacentNode, fromCostTo[adjacentNode]);
+                }
+            }
+        }
+        // Si se visitó el nodo To hay un camino.
+        if (visitedNodes[to])
+        {
+            path->push(to);
+            int node = to;
+            while (node != from)
+            {
+                node = previousNode[node];
+                path->push(node);
+            }
+        }
+        delete[] visitedNodes;
+        delete[] previousNode;
+        delete[] fromCostTo;
+        return path;
+    }
+
+    /// @brief Retorna el coste asociado al árbol de cubrimiento mínimo del grafo,
+    /// o retorna null si no se encontró uno.
+    int *prim(int from) const
+    {
+        bool *visitedNodes = new bool[_totalNodes + 1];
+        int *nodeCost = new int[_totalNodes + 1];
+        for (int i = 1; i <= _totalNodes; i++)
+        {
+            visitedNodes[i] = false;
+            nodeCost[i] = INT32_MAX;
+        }
+        nodeCost[from] = 0;
+        IndexedPQueue<int> nodesQueue(_totalNodes);
+        nodesQueue.enqueue(from, 0);
+        int visitedNodesCount = 0;
+        while (!nodesQueue.isEmpty())
+        {
+            int node = nodesQueue.front();
+            nodesQueue.dequeue();
+            visitedNodesCount++;
+            visitedNodes[node] = true;
+            for (int e = _offsets[node]; e < _offsets[node + 1]; e++)
+            {
+                int adjacentNode = _targets[e];
+                if (!visitedNodes[adjacentNode] && nodeCost[adjacentNode] > _weights[e])
+                {
+                    nodeCost[adjacentNode] = _weights[e];
+                    nodesQueue.enqueueOrDecreaseKey(adjacentNode, _weights[e]);
+                }
+            }
+        }
+        int *result = NULL;
+        if (visitedNodesCount == _totalNodes)
+        {
+            int sum = 0;
+            for (int i = 1; i <= _totalNodes; i++)
+            {
+                sum += nodeCost[i];
+            }
+            result = new int;
+            *result = sum;
+        }
+        delete[] visitedNodes;
+        delete[] nodeCost;
+        return result;
+    }
+};
+
+#endif
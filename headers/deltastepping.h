@@ -0,0 +1,270 @@
+#ifndef DELTASTEPPING_H
+#define DELTASTEPPING_H
+
+#include <atomic> // Para relajar aristas desde varios hilos.
+
+#include "csrgraph.h"
+#include "threadpool.h"
+
+/// @brief Implementa caminos más cortos desde un origen a todos los nodos con delta-stepping paralelo.
+/// Los nodos se agrupan en baldes de ancho delta según su distancia tentativa. Los nodos de un balde
+/// se procesan todos a la vez entre los hilos, relajando primero las aristas livianas (peso <= delta),
+/// que pueden volver a agregar nodos al mismo balde, y luego una única vez las pesadas.
+/// Con delta = 1 se comporta como Dijkstra por niveles, y con delta grande como Bellman-Ford.
+/// @note Precondición: los pesos de arista no son negativos.
+class DeltaStepping
+{
+private:
+    /// @brief Arreglo de enteros que crece según sea necesario. No reserva memoria hasta el primer agregado,
+    /// porque la mayoría de los baldes circulares nunca se usan.
+    class IntBuffer
+    {
+    public:
+        int *data;
+        int size;
+        int capacity;
+
+        IntBuffer() : data(NULL), size(0), capacity(0) {}
+
+        ~IntBuffer()
+        {
+            delete[] data;
+        }
+
+        void add(int value)
+        {
+            if (size == capacity)
+            {
+                int newCapacity = capacity > 0 ? 2 * capacity : 16;
+                int *newData = new int[newCapacity];
+                for (int i = 0; i < size; i++)
+                {
+                    newData[i] = data[i];
+                }
+                delete[] data;
+                data = newData;
+                capacity = newCapacity;
+            }
+            data[size++] = value;
+        }
+
+        void swap(IntBuffer &other)
+        {
+            int *auxData = data;
+            int auxSize = size;
+            int auxCapacity = capacity;
+            data = other.data;
+            size = other.size;
+            capacity = other.capacity;
+            other.data = auxData;
+            other.size = auxSize;
+            other.capacity = auxCapacity;
+        }
+    };
+
+    static const unsigned int INFINITE = INT32_MAX;
+    /// @brief Mayor cantidad de baldes circulares. Si el mayor peso dividido delta la supera, se agranda delta.
+    static const int MAX_BUCKETS = 1 << 16;
+
+    const CSRGraph &_graph;
+    ThreadPool _pool;
+    int _totalNodes;
+    int _delta;
+    /// @brief Distancia tentativa en los 32 bits altos y predecesor en los bajos, para actualizar ambos
+    /// con un único compare-and-swap. Ante distancias iguales gana el predecesor menor.
+    std::atomic<unsigned long long> *_state;
+    /// @brief Baldes circulares: todas las distancias tentativas están a menos de _bucketCount baldes del actual.
+    IntBuffer *_buckets;
+    int _bucketCount;
+    /// @brief Nodos que mejoró cada hilo en la fase actual.
+    IntBuffer *_improved;
+    /// @brief Último balde en el que se agregó cada nodo a los nodos asentados, para no repetirlo.
+    int *_settledInBucket;
+
+    static unsigned long long pack(unsigned int distance, int predecessor)
+    {
+        return ((unsigned long long)distance << 32) | (unsigned int)predecessor;
+    }
+
+    unsigned int distanceOf(int node) const
+    {
+        return (unsigned int)(_state[node].load(std::memory_order_relaxed) >> 32);
+    }
+
+    /// @brief Retorna true si mejoró la distancia del nodo.
+    bool relax(int node, unsigned int distance, int predecessor)
+    {
+        unsigned long long candidate = pack(distance, predecessor);
+        unsigned long long current = _state[node].load(std::memory_order_relaxed);
+        while (candidate < current)
+        {
+            if (_state[node].compare_exchange_weak(current, candidate, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Relaja en paralelo las aristas livianas o pesadas de los nodos dados.
+    void relaxEdges(const IntBuffer &nodes, bool light)
+    {
+        _pool.parallelFor(0, nodes.size, [&](int begin, int end, int worker)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                int node = nodes.data[i];
+                unsigned int distance = distanceOf(node);
+                for (int e = _graph.edgesBegin(node); e < _graph.edgesEnd(node); e++)
+                {
+                    int weight = _graph.weight(e);
+                    if ((weight <= _delta) == light)
+                    {
+                        unsigned int newDistance = distance + (unsigned int)weight;
+                        if (newDistance < INFINITE && relax(_graph.target(e), newDistance, node))
+                        {
+                            _improved[worker].add(_graph.target(e));
+                        }
+                    }
+                }
+            }
+        }, 32);
+    }
+
+    /// @brief Ubica en su balde a los nodos mejorados por cada hilo.
+    void distributeImproved()
+    {
+        for (int worker = 0; worker < _pool.size(); worker++)
+        {
+            for (int i = 0; i < _improved[worker].size; i++)
+            {
+                int node = _improved[worker].data[i];
+                _buckets[(distanceOf(node) / _delta) % _bucketCount].add(node);
+            }
+            _improved[worker].size = 0;
+        }
+    }
+
+public:
+    /// @brief Prepara la búsqueda sobre el grafo dado.
+    /// @param delta Ancho de los baldes. Si es menor a 1, se usa el mayor peso dividido el grado promedio.
+    /// Se agranda si con él harían falta más de MAX_BUCKETS baldes; delta() retorna el ancho utilizado.
+    /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+    explicit DeltaStepping(const CSRGraph &graph, int delta, int threads) : _graph(graph), _pool(threads)
+    {
+        _totalNodes = graph.totalNodes();
+        int maxWeight = 1;
+        for (int e = 0; e < graph.totalEdges(); e++)
+        {
+            maxWeight = graph.weight(e) > maxWeight ? graph.weight(e) : maxWeight;
+        }
+        if (delta < 1)
+        {
+            int averageDegree = _totalNodes > 0 ? graph.totalEdges() / _totalNodes : 1;
+            delta = maxWeight / (averageDegree > 0 ? averageDegree : 1);
+        }
+        _delta = delta > 0 ? delta : 1;
+        if (maxWeight / _delta + 2 > MAX_BUCKETS)
+        {
+            _delta = maxWeight / (MAX_BUCKETS - 2) + 1;
+        }
+        _bucketCount = maxWeight / _delta + 2;
+        _state = new std::atomic<unsigned long long>[_totalNodes + 1];
+        _buckets = new IntBuffer[_bucketCount];
+        _improved = new IntBuffer[_pool.size()];
+        _settledInBucket = new int[_totalNodes + 1];
+    }
+
+    ~DeltaStepping()
+    {
+        delete[] _state;
+        delete[] _buckets;
+        delete[] _improved;
+        delete[] _settledInBucket;
+    }
+
+    int delta() const
+    {
+        return _delta;
+    }
+
+    /// @brief Calcula la distancia y el predecesor en un camino más corto desde el nodo dado hasta cada nodo.
+    /// @param distances Arreglo de totalNodes + 1 posiciones para las distancias. Los nodos no alcanzados quedan en INT32_MAX.
+    /// @param predecessors Arreglo de totalNodes + 1 posiciones para los predecesores. El del origen es él mismo y
+    /// el de los nodos no alcanzados es 0.
+    void search(int from, int *distances, int *predecessors)
+    {
+        _pool.parallelFor(0, _totalNodes + 1, [&](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                _state[i].store(pack(INFINITE, 0), std::memory_order_relaxed);
+                _settledInBucket[i] = -1;
+            }
+        });
+        for (int i = 0; i < _bucketCount; i++)
+        {
+            _buckets[i].size = 0;
+        }
+        _state[from].store(pack(0, from), std::memory_order_relaxed);
+        _buckets[0].add(from);
+
+        IntBuffer frontier;
+        IntBuffer settled;
+        int bucket = 0;
+        int emptyBuckets = 0;
+        // Si se recorren todos los baldes circulares sin encontrar nodos, no quedan distancias por mejorar.
+        while (emptyBuckets < _bucketCount)
+        {
+            IntBuffer &current = _buckets[bucket % _bucketCount];
+            if (current.size == 0)
+            {
+                emptyBuckets++;
+                bucket++;
+                continue;
+            }
+            emptyBuckets = 0;
+            settled.size = 0;
+            while (current.size > 0)
+            {
+                frontier.swap(current);
+                current.size = 0;
+                // Se descartan los nodos cuya distancia ya los llevó a un balde anterior.
+                int valid = 0;
+                for (int i = 0; i < frontier.size; i++)
+                {
+                    int node = frontier.data[i];
+                    if ((int)(distanceOf(node) / _delta) == bucket && _settledInBucket[node] != bucket)
+                    {
+                        _settledInBucket[node] = bucket;
+                        frontier.data[valid++] = node;
+                        settled.add(node);
+                    }
+                }
+                frontier.size = valid;
+                relaxEdges(frontier, true);
+                distributeImproved();
+                // Un nodo del balde que vuelve a mejorar debe relajar otra vez sus aristas.
+                for (int i = 0; i < current.size; i++)
+                {
+                    _settledInBucket[current.data[i]] = -1;
+                }
+            }
+            relaxEdges(settled, false);
+            distributeImproved();
+            bucket++;
+        }
+
+        _pool.parallelFor(0, _totalNodes + 1, [&](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                unsigned long long state = _state[i].load(std::memory_order_relaxed);
+                distances[i] = (int)(state >> 32);
+                predecessors[i] = (int)(state & 0xFFFFFFFFULL);
+            }
+        });
+    }
+};
+
+#endif
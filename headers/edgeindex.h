@@ -0,0 +1,168 @@
+#ifndef EDGEINDEX_H
+#define EDGEINDEX_H
+
+#include "csrgraph.h"
+#include "hash.h"
+
+/// @brief Índice que usa Graph para buscar aristas en modo de listas.
+/// SORTED_ADJACENCY guarda las aristas de cada nodo ordenadas por destino y busca en O(log d) con búsqueda
+/// binaria. HASH_INDEX guarda cada par (origen, destino) en una tabla de hash y busca en O(1) esperado, a
+/// cambio de más memoria.
+enum EdgeIndexType {NO_EDGE_INDEX, SORTED_ADJACENCY, HASH_INDEX};
+
+/// @brief Implementa la búsqueda de aristas por origen y destino sobre una copia del grafo.
+/// Si hay varias aristas entre los mismos nodos, se encuentra la primera que se agregó.
+class EdgeIndex
+{
+private:
+    EdgeIndexType _type;
+    /// @brief Copia de los arreglos CSR del grafo con las aristas de cada nodo ordenadas por destino,
+    /// para SORTED_ADJACENCY.
+    int *_offsets;
+    int *_targets;
+    int *_weights;
+    /// @brief Peso de cada arista, con la clave de pairKey, para HASH_INDEX.
+    HashTable<long long, int> *_table;
+
+    static long long pairKey(int from, int to)
+    {
+        return ((long long)from << 32) | (unsigned int)to;
+    }
+
+    /// @brief Mezcla los bits de la clave (multiplicación de Fibonacci), para que los pares de un mismo
+    /// origen no caigan en buckets consecutivos.
+    static int hashPair(long long key)
+    {
+        unsigned long long mixed = (unsigned long long)key * 0x9E3779B97F4A7C15ULL;
+        return (int)(mixed >> 33);
+    }
+
+    /// @brief Ordena las aristas [begin, end) por destino con un merge sort estable, para que las aristas
+    /// repetidas conserven el orden en que se agregaron. Los arreglos auxiliares tienen end - begin posiciones.
+    void sortRow(int begin, int end, int *scratchTargets, int *scratchWeights)
+    {
+        for (int width = 1; width < end - begin; width *= 2)
+        {
+            for (int left = begin; left < end; left += 2 * width)
+            {
+                int middle = left + width < end ? left + width : end;
+                int right = middle + width < end ? middle + width : end;
+                int i = left;
+                int j = middle;
+                int k = left - begin;
+                while (i < middle || j < right)
+                {
+                    bool takeLeft = j == right || (i < middle && _targets[i] <= _targets[j]);
+                    int source = takeLeft ? i++ : j++;
+                    scratchTargets[k] = _targets[source];
+                    scratchWeights[k++] = _weights[source];
+                }
+            }
+            for (int i = begin; i < end; i++)
+            {
+                _targets[i] = scratchTargets[i - begin];
+                _weights[i] = scratchWeights[i - begin];
+            }
+        }
+    }
+
+public:
+    /// @brief Construye el índice con las aristas del grafo.
+    /// Precondición: type no es NO_EDGE_INDEX.
+    explicit EdgeIndex(const CSRGraph &graph, EdgeIndexType type)
+    {
+        assert(type != NO_EDGE_INDEX);
+        _type = type;
+        _offsets = NULL;
+        _targets = NULL;
+        _weights = NULL;
+        _table = NULL;
+        if (type == SORTED_ADJACENCY)
+        {
+            int totalNodes = graph.totalNodes();
+            int totalEdges = graph.totalEdges();
+            _offsets = new int[totalNodes + 2];
+            _targets = new int[totalEdges > 0 ? totalEdges : 1];
+            _weights = new int[totalEdges > 0 ? totalEdges : 1];
+            for (int u = 0; u <= totalNodes + 1; u++)
+            {
+                _offsets[u] = graph.offsets()[u];
+            }
+            int longestRow = 0;
+            for (int u = 1; u <= totalNodes; u++)
+            {
+                longestRow = _offsets[u + 1] - _offsets[u] > longestRow ? _offsets[u + 1] - _offsets[u] : longestRow;
+            }
+            for (int e = 0; e < totalEdges; e++)
+            {
+                _targets[e] = graph.target(e);
+                _weights[e] = graph.weight(e);
+            }
+            int *scratchTargets = new int[longestRow > 0 ? longestRow : 1];
+            int *scratchWeights = new int[longestRow > 0 ? longestRow : 1];
+            for (int u = 1; u <= totalNodes; u++)
+            {
+                sortRow(_offsets[u], _offsets[u + 1], scratchTargets, scratchWeights);
+            }
+            delete[] scratchTargets;
+            delete[] scratchWeights;
+        }
+        else
+        {
+            // Con una posición más que aristas, la tabla no llega al factor de carga que la redimensiona.
+            _table = new HashTable<long long, int>(graph.totalEdges() + 1, hashPair);
+            for (int u = 1; u <= graph.totalNodes(); u++)
+            {
+                for (int e = graph.edgesBegin(u); e < graph.edgesEnd(u); e++)
+                {
+                    _table->add(pairKey(u, graph.target(e)), graph.weight(e));
+                }
+            }
+        }
+    }
+
+    ~EdgeIndex()
+    {
+        delete[] _offsets;
+        delete[] _targets;
+        delete[] _weights;
+        delete _table;
+    }
+
+    EdgeIndexType type() const
+    {
+        return _type;
+    }
+
+    /// @brief Busca la arista entre los nodos. Si existe, guarda su peso en weight y retorna true.
+    bool find(int from, int to, int &weight) const
+    {
+        if (_type == HASH_INDEX)
+        {
+            return _table->tryGetValue(pairKey(from, to), weight);
+        }
+        // Se busca la primera arista con destino mayor o igual a to.
+        int low = _offsets[from];
+        int high = _offsets[from + 1];
+        while (low < high)
+        {
+            int middle = low + (high - low) / 2;
+            if (_targets[middle] < to)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        if (low < _offsets[from + 1] && _targets[low] == to)
+        {
+            weight = _weights[low];
+            return true;
+        }
+        return false;
+    }
+};
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef EYTZINGER_H
+#define EYTZINGER_H
+
+/// @brief Índice de búsqueda estático e inmutable de tipo T, en disposición de Eytzinger (BFS).
+/// El nodo k tiene sus hijos en 2k y 2k+1, por lo que los primeros niveles comparten
+/// líneas de caché y la búsqueda no necesita punteros ni saltos condicionales.
+/// Ocupa un T por elemento, frente a un dato, una altura y dos punteros por nodo del AVL.
+/// @note Como en el resto de las estructuras, no se utiliza el índice 0.
+template <typename T>
+class EytzingerIndex
+{
+private:
+    T *_tree;
+    int _size;
+    /// @brief Cantidad de niveles del árbol y cantidad de nodos de su último nivel.
+    int _levels;
+    int _lastLevelNodes;
+
+    /// @brief Distancia en nodos hasta los descendientes que se precargan: los de cuatro niveles más abajo
+    /// ocupan posiciones contiguas desde 16k, que es una línea de caché para elementos de 4 bytes.
+    static const int PREFETCH_DISTANCE = 16;
+
+    int build(const T *sortedElements, int sortedIndex, int treeIndex)
+    {
+        if (treeIndex <= _size)
+        {
+            sortedIndex = build(sortedElements, sortedIndex, 2 * treeIndex);
+            _tree[treeIndex] = sortedElements[sortedIndex];
+            sortedIndex = build(sortedElements, sortedIndex + 1, 2 * treeIndex + 1);
+        }
+        return sortedIndex;
+    }
+
+    /// @brief Retorna la parte entera del logaritmo en base 2. Precondición: value > 0.
+    static int floorLog2(unsigned int value)
+    {
+#if defined(__GNUC__)
+        return 31 - __builtin_clz(value);
+#else
+        int result = 0;
+        while (value >>= 1)
+        {
+            result++;
+        }
+        return result;
+#endif
+    }
+
+    /// @brief Retorna la posición (desde 1) del bit en 0 menos significativo. Precondición: value no tiene todos los bits en 1.
+    static int lowestZeroBit(unsigned int value)
+    {
+#if defined(__GNUC__)
+        return __builtin_ffs(~value);
+#else
+        int position = 1;
+        while (value & 1)
+        {
+            value >>= 1;
+            position++;
+        }
+        return position;
+#endif
+    }
+
+    /// @brief Retorna el índice del árbol del primer elemento mayor o igual al dado,
+    /// o 0 si todos son menores.
+    int lowerBoundIndex(const T &element) const
+    {
+        unsigned int k = 1;
+        while (k <= (unsigned int)_size)
+        {
+#if defined(__GNUC__)
+            // Se precarga sólo dentro del arreglo: formar un puntero más allá del final no está definido.
+            size_t prefetchIndex = (size_t)k * PREFETCH_DISTANCE;
+            prefetchIndex = prefetchIndex < (size_t)_size ? prefetchIndex : (size_t)_size;
+            __builtin_prefetch(_tree + prefetchIndex);
+#endif
+            // Se desciende a la izquierda o a la derecha sin saltos según el resultado de la comparación.
+            k = 2 * k + (unsigned int)(_tree[k] < element);
+        }
+        // Se deshacen los últimos descensos a la derecha más el último a la izquierda.
+        k >>= lowestZeroBit(k);
+        return (int)k;
+    }
+
+    /// @brief Retorna la posición en orden (desde 0) del elemento guardado en el índice k del árbol.
+    /// Si el árbol fuera perfecto, el nodo k del nivel h estaría en la posición (2 (k - 2^h) + 1) 2^(niveles - h - 1) - 1.
+    /// Las hojas que le faltan al último nivel son las de la derecha, que en un árbol perfecto ocupan las
+    /// posiciones pares desde 2 * _lastLevelNodes, así que se descuentan las que quedan antes.
+    int rankOf(int k) const
+    {
+        int level = floorLog2((unsigned int)k);
+        long long position = ((2LL * (k - (1LL << level)) + 1) << (_levels - level - 1)) - 1;
+        long long missing = position - 2LL * _lastLevelNodes + 1;
+        return (int)(position - (missing > 0 ? missing / 2 : 0));
+    }
+
+public:
+    /// @brief Construye el índice a partir de un arreglo de elementos ordenado de menor a mayor.
+    /// @param sortedElements Los elementos ordenados, desde la posición 0.
+    /// @param size Cantidad de elementos.
+    explicit EytzingerIndex(const T *sortedElements, int size)
+    {
+        _size = size;
+        _tree = new T[_size + 1];
+        _levels = _size > 0 ? floorLog2((unsigned int)_size) + 1 : 0;
+        _lastLevelNodes = _size > 0 ? _size - ((1 << (_levels - 1)) - 1) : 0;
+        build(sortedElements, 0, 1);
+    }
+
+    ~EytzingerIndex()
+    {
+        delete[] _tree;
+    }
+
+    int size() const
+    {
+        return _size;
+    }
+
+    bool isEmpty() const
+    {
+        return _size == 0;
+    }
+
+    /// @brief Retorna true si el elemento pertenece al índice.
+    bool contains(const T &element) const
+    {
+        int k = lowerBoundIndex(element);
+        return k != 0 && !(element < _tree[k]);
+    }
+
+    /// @brief Retorna true si existe un elemento mayor o igual al dado, y lo asigna en outElement.
+    bool lowerBound(const T &element, T &outElement) const
+    {
+        int k = lowerBoundIndex(element);
+        if (k != 0)
+        {
+            outElement = _tree[k];
+        }
+        return k != 0;
+    }
+
+    /// @brief Retorna la cantidad de elementos estrictamente menores al dado.
+    int rank(const T &element) const
+    {
+        int k = lowerBoundIndex(element);
+        return k != 0 ? rankOf(k) : _size;
+    }
+
+    /// @brief Retorna la cantidad de bytes que ocupa el índice.
+    size_t memoryUsage() const
+    {
+        return sizeof(*this) + (size_t)(_size + 1) * sizeof(T);
+    }
+};
+
+#endif
@@ -10,6 +10,27 @@
 #include "queue.h"
 #include "stack.h"
 #include "pqueue.h"
+#include "indexedpqueue.h"
+#include "radixheap.h"
+#include "bucketqueue.h"
+#include "csrgraph.h"
+#include "parallelbfs.h"
+#include "deltastepping.h"
+#include "pointtopoint.h"
+#include "contraction.h"
+#include "allpairs.h"
+#include "mst.h"
+#include "components.h"
+#include "reorder.h"
+#include "pagerank.h"
+#include "edgeindex.h"
+#include "wavefront.h"
+#include "compressedgraph.h"
+#include "graphvisitor.h"
+
+/// @brief Cola de prioridad que utilizan los algoritmos de caminos más cortos y de árbol de cubrimiento.
+/// RADIX_HEAP y BUCKET_QUEUE sólo admiten pesos de arista enteros no negativos.
+enum PriorityQueueType {BINARY_HEAP, RADIX_HEAP, BUCKET_QUEUE};
 
 /// @brief Implementa un grafo híbrido, según el parámetro del constructor
 /// que indica que es denso, si es verdadero, usará matrices, de lo contrario
@@ -34,6 +55,8 @@ class Graph
         };
         int _totalNodes;
         int _totalEdges;
+        /// @brief Mayor peso de arista del grafo, que acota el rango de prioridades de la cola de baldes.
+        int _maxWeight;
         bool _isDense;
         bool _isDirected;
         bool _isWeighted;
@@ -42,8 +65,25 @@ class Graph
         /// @brief El arreglo indica el grado de incidencia de cada nodo.
         int * _nodesInDegreeArray;
         int * _nodesOutDegreeArray;
-        /// @brief Cada coordenada from, to, representa una arista con su peso. Si no hay arista, el valor es nulo.
-        int *** _edgesMatrix;
+        /// @brief Matriz contigua de pesos: la posición from * (_totalNodes+1) + to guarda el peso de la arista.
+        /// Si no hay arista, guarda NO_EDGE.
+        int * _edgesMatrix;
+        /// @brief Matriz de adyacencia empaquetada en bits: la fila de cada nodo ocupa _wordsPerRow palabras,
+        /// y el bit to de la fila from indica si existe la arista.
+        unsigned long long * _adjacencyBits;
+        int _wordsPerRow;
+        /// @brief Vistas CSR del grafo y de su inverso que usan los algoritmos paralelos.
+        /// Se construyen cuando se necesitan y se descartan al agregar una arista.
+        CSRGraph * _csrGraph;
+        CSRGraph * _reverseCsrGraph;
+        /// @brief Búsqueda entre pares de nodos sobre las vistas CSR, que se reutiliza entre consultas.
+        PointToPointSearch * _pointToPointSearch;
+        /// @brief Índice de aristas del modo de listas, que se construye con la primera búsqueda
+        /// y se descarta al agregar una arista, como las vistas CSR.
+        EdgeIndexType _edgeIndexType;
+        EdgeIndex * _edgeIndex;
+
+        static const int NO_EDGE = INT32_MIN;
 
         void initListGraph()
         {
@@ -52,24 +92,40 @@ class Graph
 
         void initMatrixGraph()
         {
-            _edgesMatrix = new int**[_totalNodes+1];
-            for(int i = 1; i <= _totalNodes; i++)
+            size_t cells = (size_t)(_totalNodes+1) * (_totalNodes+1);
+            _edgesMatrix = new int[cells];
+            for(size_t i = 0; i < cells; i++)
             {
-                _edgesMatrix[i] = new int*[_totalNodes+1];
-                // Si no es dirigido uso la mitad superior de la diagonal principal de la matriz.
-                int j = _isDirected ? 1 : i;
-                for (j = 1; j <= _totalNodes; j++)
-                {
-                    _edgesMatrix[i][j] = NULL;
-                }                
+                _edgesMatrix[i] = NO_EDGE;
             }
+            _wordsPerRow = (_totalNodes + 1 + 63) / 64;
+            size_t words = (size_t)(_totalNodes+1) * _wordsPerRow;
+            _adjacencyBits = new unsigned long long[words];
+            for(size_t i = 0; i < words; i++)
+            {
+                _adjacencyBits[i] = 0;
+            }
+        }
+
+        size_t matrixIndex(int nodeFrom, int nodeTo) const
+        {
+            return (size_t)nodeFrom * (_totalNodes+1) + nodeTo;
+        }
+
+        /// @brief Guarda la arista en ambas matrices. Retorna true si la arista no existía.
+        bool mSetEdge(int nodeFrom, int nodeTo, int weight)
+        {
+            bool isNew = _edgesMatrix[matrixIndex(nodeFrom, nodeTo)] == NO_EDGE;
+            _edgesMatrix[matrixIndex(nodeFrom, nodeTo)] = weight;
+            _adjacencyBits[(size_t)nodeFrom * _wordsPerRow + nodeTo / 64] |= 1ULL << (nodeTo % 64);
+            return isNew;
         }
 
         /// @brief Retorna un heap con los nodos de grado cero.
         /// Si no los hay, retorna un heap vacío.
-        Heap<int> * getCeroInDegreeNodes() const
+        Heap<int, MinComparator<int> > * getCeroInDegreeNodes() const
         {
-            Heap<int> * nodesHeap = new Heap<int>(_totalNodes, MIN);
+            Heap<int, MinComparator<int> > * nodesHeap = new Heap<int, MinComparator<int> >(_totalNodes);
             for (int i = 1; i <= _totalNodes; i++)
             {
                 if(_nodesInDegreeArray[i] == 0)
@@ -80,12 +136,68 @@ class Graph
             return nodesHeap;
         }
 
+        double * copyRanks(const PageRank & ranking)
+        {
+            double * ranks = new double[_totalNodes + 1];
+            for (int i = 0; i <= _totalNodes; i++)
+            {
+                ranks[i] = ranking.rank(i);
+            }
+            return ranks;
+        }
+
+        /// @brief Descarta las vistas CSR, que dejan de reflejar el grafo.
+        void invalidateCSR()
+        {
+            delete _pointToPointSearch;
+            delete _edgeIndex;
+            delete _csrGraph;
+            delete _reverseCsrGraph;
+            _pointToPointSearch = NULL;
+            _edgeIndex = NULL;
+            _csrGraph = NULL;
+            _reverseCsrGraph = NULL;
+        }
+
+        const CSRGraph & getCSR()
+        {
+            if(_csrGraph == NULL)
+            {
+                _csrGraph = toCSR(ThreadPool::hardwareThreads());
+            }
+            return *_csrGraph;
+        }
+
+        /// @brief Retorna la vista CSR con las aristas invertidas. Si el grafo no es dirigido, es la misma vista.
+        const CSRGraph & getReverseCSR()
+        {
+            if(!_isDirected)
+            {
+                return getCSR();
+            }
+            if(_reverseCsrGraph == NULL)
+            {
+                _reverseCsrGraph = getCSR().transpose(ThreadPool::hardwareThreads());
+            }
+            return *_reverseCsrGraph;
+        }
+
+        PointToPointSearch & getPointToPointSearch()
+        {
+            if(_pointToPointSearch == NULL)
+            {
+                _pointToPointSearch = new PointToPointSearch(getCSR(), getReverseCSR());
+            }
+            return *_pointToPointSearch;
+        }
+
         #pragma region métodos grafo de matríz
 
         /// @brief Agrega una arista al grafo y actualiza los grados de incidencia de sus nodos. 
         /// Si el grafo es no dirigido, la arista se agrega en ambos nodos.
         /// Los nodos son numerados desde 1 hasta la cantidad máxima de nodos del grafo. 
         /// Si se intenta insertar un nodo con un número menor que 1, el método no tiene efecto.
+        /// Si la arista ya existía, sólo se actualiza su peso.
         /// @param nodeFrom Nodo del cual sale la arista.
         /// @param nodeTo Nodo al cual se dirige la arista.
         /// @param weight Peso de la arista.
@@ -93,18 +205,19 @@ class Graph
         {
             if(nodeFrom > 0 && nodeTo > 0)
             {
-                int * w = new int;
-                *w = _isWeighted ? weight : 1;
-                _edgesMatrix[nodeFrom][nodeTo] = w;
-                _nodesInDegreeArray[nodeTo]++;
-                _nodesOutDegreeArray[nodeFrom]++;
-                if(!_isDirected)
+                int w = _isWeighted ? weight : 1;
+                if(mSetEdge(nodeFrom, nodeTo, w))
+                {
+                    _nodesInDegreeArray[nodeTo]++;
+                    _nodesOutDegreeArray[nodeFrom]++;
+                    _totalEdges++;
+                }
+                // Si no es dirigido la matriz es simétrica.
+                if(!_isDirected && mSetEdge(nodeTo, nodeFrom, w))
                 {
-                    *_edgesMatrix[nodeTo][nodeFrom] = _isWeighted ? weight : 1;
                     _nodesInDegreeArray[nodeFrom]++;
-                    _nodesOutDegreeArray[nodeTo]++;                
+                    _nodesOutDegreeArray[nodeTo]++;
                 }
-                _totalEdges++;
             }   
         }
 
@@ -113,61 +226,113 @@ class Graph
         /// @return 
         int mEdgeWeight(int nodeFrom, int nodeTo)
         {
-            if(!_isDirected)
-            {
-                // Si no es dirigido uso la mitad superior de la diagonal principal de la matriz.
-                return nodeFrom >= nodeTo 
-                ? *_edgesMatrix[nodeFrom][nodeTo] 
-                : *_edgesMatrix[nodeTo][nodeFrom];
-            }
-            else
+            return _edgesMatrix[matrixIndex(nodeFrom, nodeTo)];
+        }
+
+        /// @brief Aplica f(adjacentNode, weight) a cada nodo adyacente al nodo indicado, en orden creciente.
+        /// Recorre la fila de bits de a una palabra, saltando con ctz directamente a cada arista.
+        template <class F>
+        void mAdjacents(int from, F f)
+        {
+            const unsigned long long * row = _adjacencyBits + (size_t)from * _wordsPerRow;
+            const int * weights = _edgesMatrix + matrixIndex(from, 0);
+            for(int word = 0; word < _wordsPerRow; word++)
             {
-                return *_edgesMatrix[nodeFrom][nodeTo];
+                unsigned long long bits = row[word];
+                while (bits != 0)
+                {
+                    int node = word * 64 + __builtin_ctzll(bits);
+                    bits &= bits - 1;
+                    f(node, weights[node]);
+                }
             }
         }
 
-        /// @brief Retrona el arreglo con los posibles nodos adyacentes al nodo indicado.
-        /// Si el nodo no tiene adyacentes, retorna null.
-        int ** mAdjacents(int from)
+        /// @brief Retorna el menor nodo adyacente al nodo indicado que sea mayor o igual a start, o 0 si no hay.
+        int mNextAdjacent(int from, int start) const
         {
-            if(_nodesOutDegreeArray[from] > 0)
+            if(start > _totalNodes)
+            {
+                return 0;
+            }
+            const unsigned long long * row = _adjacencyBits + (size_t)from * _wordsPerRow;
+            int word = start / 64;
+            unsigned long long bits = row[word] & (~0ULL << (start % 64));
+            while (bits == 0 && ++word < _wordsPerRow)
             {
-                return _edgesMatrix[from];
+                bits = row[word];
             }
-            return NULL;
-        }     
+            return bits != 0 ? word * 64 + __builtin_ctzll(bits) : 0;
+        }
 
-        /// @brief Realiza el recorrido por anchura del grafo, aplicándole a cada nodo
-        // la función enviada por parámetro.
-        /// @param nodeFrom El nodo desde donde comienza la recorrida.
-        /// @param function La función que se ejecuta sobre cada nodo.
-        void mBfSearch(int nodeFrom, std::function<void(int, int)> f)
+        /// @brief Realiza el recorrido por anchura sobre la matriz, llamando a los métodos del visitante.
+        /// Cada nodo se marca al descubrirlo, así que se descubre una única vez.
+        template <class V>
+        void mBreadthFirst(int nodeFrom, V & visitor, bool * visitedNodes)
         {
-            bool visitedNodes[_totalNodes+1];
-            for(int i = 1; i <= _totalNodes; visitedNodes[i++] = false);            
+            int * nodesQueue = new int[_totalNodes];
+            int * depths = new int[_totalNodes+1];
+            int queueBegin = 0;
+            int queueEnd = 0;
             visitedNodes[nodeFrom] = true;
-            Queue<Tuple<int, int>> nodesQueue = Queue<Tuple<int,int>>();
-            nodesQueue.enqueue(Tuple<int,int>(nodeFrom, 0));
-            while (!nodesQueue.isEmpty())
+            depths[nodeFrom] = 0;
+            nodesQueue[queueEnd++] = nodeFrom;
+            bool running = visitor.discoverNode(nodeFrom, 0);
+            while (running && queueBegin < queueEnd)
             {
-                Tuple<int,int> tuple = nodesQueue.front();
-                nodesQueue.dequeue();
-                int node = tuple.first;
-                int step = tuple.second;
-                f(node, step);                
-                int ** adjacentNodes = mAdjacents(node);
-                if(adjacentNodes != NULL)
+                int node = nodesQueue[queueBegin++];
+                for (int adjacentNode = mNextAdjacent(node, 1); running && adjacentNode != 0; adjacentNode = mNextAdjacent(node, adjacentNode + 1))
                 {
-                    for(int i = 1; i <= _totalNodes; i++)
+                    if(visitor.examineEdge(node, adjacentNode, _edgesMatrix[matrixIndex(node, adjacentNode)]) && !visitedNodes[adjacentNode])
                     {
-                        if(adjacentNodes[i] != NULL && !visitedNodes[*adjacentNodes[i]])
-                        {
-                            visitedNodes[*adjacentNodes[i]] = true;
-                            nodesQueue.enqueue(Tuple<int,int>(*adjacentNodes[i], step + 1));
-                        }
+                        visitedNodes[adjacentNode] = true;
+                        depths[adjacentNode] = depths[node] + 1;
+                        nodesQueue[queueEnd++] = adjacentNode;
+                        running = visitor.discoverNode(adjacentNode, depths[adjacentNode]);
                     }
                 }
+                if(running)
+                {
+                    visitor.finishNode(node);
+                }
             }
+            delete[] nodesQueue;
+            delete[] depths;
+        }
+
+        /// @brief Realiza el recorrido en profundidad sobre la matriz con una pila explícita, en el mismo orden
+        /// que la versión recursiva: cada nodo de la pila guarda desde qué adyacente continúa.
+        template <class V>
+        void mDepthFirst(int nodeFrom, V & visitor, bool * visitedNodes)
+        {
+            int * nodesStack = new int[_totalNodes+1];
+            int * nextCandidate = new int[_totalNodes+1];
+            int stackSize = 0;
+            visitedNodes[nodeFrom] = true;
+            nodesStack[stackSize] = nodeFrom;
+            nextCandidate[stackSize++] = 1;
+            bool running = visitor.discoverNode(nodeFrom, 0);
+            while (running && stackSize > 0)
+            {
+                int node = nodesStack[stackSize-1];
+                int adjacentNode = mNextAdjacent(node, nextCandidate[stackSize-1]);
+                if(adjacentNode == 0)
+                {
+                    visitor.finishNode(node);
+                    stackSize--;
+                    continue;
+                }
+                nextCandidate[stackSize-1] = adjacentNode + 1;
+                if(visitor.examineEdge(node, adjacentNode, _edgesMatrix[matrixIndex(node, adjacentNode)]) && !visitedNodes[adjacentNode])
+                {
+                    visitedNodes[adjacentNode] = true;
+                    nodesStack[stackSize] = adjacentNode;
+                    nextCandidate[stackSize++] = 1;
+                    running = visitor.discoverNode(adjacentNode, stackSize - 1);
+                }
+            }
+            delete[] nodesStack;
+            delete[] nextCandidate;
         }
         
         /// @brief Retorna una lista con el órden topológico de los nodos, ordenados
@@ -181,13 +346,13 @@ class Graph
             {
                 return resultList;
             }
-            int nodesInDegreeAuxArray[_totalNodes+1];
+            int * nodesInDegreeAuxArray = new int[_totalNodes+1];
             // Se copia el arreglo para no modificar el global.
             for(int i = 1; i <= _totalNodes; i++)
             {
                 nodesInDegreeAuxArray[i] = _nodesInDegreeArray[i];
             }
-            Heap<int> * ceroInDegreeNodesHeap = getCeroInDegreeNodes();
+            Heap<int, MinComparator<int> > * ceroInDegreeNodesHeap = getCeroInDegreeNodes();
             int visitedNodesCount = 0;
             while (!ceroInDegreeNodesHeap->isEmpty())
             {
@@ -195,20 +360,17 @@ class Graph
                 int node = ceroInDegreeNodesHeap->top();
                 ceroInDegreeNodesHeap->removeTop();
                 resultList->add(node);
-                int ** nodeAdjacents = mAdjacents(node);
-                if(nodeAdjacents != NULL)
-                {                    
-                    // Se "eliminan aristas" bajando el grado de todos los nodos incididos desde el nodo actual.
-                    for(int i = 1; i <= _totalNodes; i++)
+                // Se "eliminan aristas" bajando el grado de todos los nodos incididos desde el nodo actual.
+                mAdjacents(node, [&](int adjacentNode, int)
+                {
+                    if(--nodesInDegreeAuxArray[adjacentNode] == 0)
                     {
-                        if(nodeAdjacents[i] != NULL && --nodesInDegreeAuxArray[i] == 0)
-                        {
-                            ceroInDegreeNodesHeap->add(i);
-                        }
+                        ceroInDegreeNodesHeap->add(adjacentNode);
                     }
-                }
+                });
             }
             delete ceroInDegreeNodesHeap;
+            delete[] nodesInDegreeAuxArray;
             if(visitedNodesCount < _totalNodes)
             {
                 resultList->clear();
@@ -219,12 +381,14 @@ class Graph
 
         /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro.
         /// Precondición: el grafo es ponderado con pesos de arista no negativos.
-        Stack<int> * mDijkstra(int from, int to)
+        /// @param unvisitedNodes Cola de prioridad indexada vacía (IndexedPQueue, RadixHeap o BucketQueue).
+        template <class Q>
+        Stack<int> * mDijkstra(int from, int to, Q & unvisitedNodes)
         {
             Stack<int> * path = new Stack<int>();
-            bool visitedNodes[_totalNodes+1];
-            int previousNode[_totalNodes+1]; // indica el nodo previo al nodo [i].
-            int fromDistanceTo[_totalNodes+1]; // representa la distancia del nodo "from" hasta el nodo [i].
+            bool * visitedNodes = new bool[_totalNodes+1];
+            int * previousNode = new int[_totalNodes+1]; // indica el nodo previo al nodo [i].
+            int * fromDistanceTo = new int[_totalNodes+1]; // representa la distancia del nodo "from" hasta el nodo [i].
             for (int i = 1; i <= _totalNodes; i++)
             {
                 visitedNodes[i] = false;
@@ -232,7 +396,6 @@ class Graph
                 fromDistanceTo[i] = INT32_MAX;
             }
             fromDistanceTo[from] = 0;
-            PQueue<int> unvisitedNodes = PQueue<int>(_totalNodes+_totalEdges);
             unvisitedNodes.enqueue(from, 0);
             while (!unvisitedNodes.isEmpty())
             {
@@ -243,23 +406,17 @@ class Graph
                     visitedNodes[node] = true;
                     if(node != to)
                     {
-                        int ** nodeAdjacents = mAdjacents(node);
-                        for (int i = 1; nodeAdjacents != NULL && i <= _totalNodes; i++)
+                        mAdjacents(node, [&](int adjacentNode, int weight)
                         {
-                            if(nodeAdjacents[i] != NULL)
+                            // Si la distancia desde From al adyacente del nodo actual es mayor que la distancia desde From al 
+                            // al nodo actual sumado a la distancia del nodo actual a su adyacente, entonces entra.
+                            if(!visitedNodes[adjacentNode] && fromDistanceTo[adjacentNode] > fromDistanceTo[node] + weight)
                             {
-                                int adjacentNode = i;
-                                int weight = *nodeAdjacents[i];
-                                // Si la distancia desde From al adyacente del nodo actual es mayor que la distancia desde From al 
-                                // al nodo actual sumado a la distancia del nodo actual a su adyacente, entonces entra.
-                                if(!visitedNodes[adjacentNode] && fromDistanceTo[adjacentNode] > fromDistanceTo[node] + weight)
-                                {
-                                    previousNode[adjacentNode] = node;
-                                    fromDistanceTo[adjacentNode] = fromDistanceTo[node] + weight;
-                                    unvisitedNodes.enqueue(adjacentNode, fromDistanceTo[node] + weight);
-                                }
+                                previousNode[adjacentNode] = node;
+                                fromDistanceTo[adjacentNode] = fromDistanceTo[node] + weight;
+                                unvisitedNodes.enqueueOrDecreaseKey(adjacentNode, fromDistanceTo[node] + weight);
                             }
-                        }
+                        });
                     }
                 }
             }
@@ -274,22 +431,26 @@ class Graph
                     path->push(node);
                 }
             }            
+            delete[] visitedNodes;
+            delete[] previousNode;
+            delete[] fromDistanceTo;
             return path;
         }
 
         /// @brief Retorna el coste asociado al árbol de cubrimiento mínimo del grafo,
         /// o retorna null si no se encontró uno.
-        int * mprim(int from)
+        /// @param nodesQueue Cola de prioridad indexada vacía (IndexedPQueue o BucketQueue).
+        template <class Q>
+        int * mprim(int from, Q & nodesQueue)
         {
-            bool visitedNodes[_totalNodes+1];
-            int nodeCost[_totalNodes+1];
+            bool * visitedNodes = new bool[_totalNodes+1];
+            int * nodeCost = new int[_totalNodes+1];
             for (int i = 1; i <= _totalNodes; i++)
             {
                 visitedNodes[i] = false;
                 nodeCost[i] = INT32_MAX;
             }
             nodeCost[from] = 0;
-            PQueue<int> nodesQueue = PQueue<int>(_totalNodes + _totalEdges);
             nodesQueue.enqueue(from, 0);
             int visitedNodesCount = 0;
 
@@ -301,21 +462,17 @@ class Graph
                 {
                     visitedNodesCount++;
                     visitedNodes[node] = true;
-                    int ** adjacentsNodes = mAdjacents(node);
-                    if(adjacentsNodes != NULL)
+                    mAdjacents(node, [&](int adjacentNode, int cost)
                     {
-                        for(int node = 1; node <= _totalNodes && adjacentsNodes[node] != NULL; node++)
+                        if(!visitedNodes[adjacentNode] && nodeCost[adjacentNode] > cost)
                         {
-                            int cost = *adjacentsNodes[node];
-                            if(!visitedNodes[node] && nodeCost[node] > cost)
-                            {
-                                nodeCost[node] = cost;
-                                nodesQueue.enqueue(node, cost);
-                            }
+                            nodeCost[adjacentNode] = cost;
+                            nodesQueue.enqueueOrDecreaseKey(adjacentNode, cost);
                         }
-                    }
+                    });
                 }                
             }
+            int * result = NULL;
             if(visitedNodesCount == _totalNodes)
             {
                 int sum = 0;
@@ -323,14 +480,12 @@ class Graph
                 {
                     sum+= nodeCost[i];
                 }
-                int * result = new int;
+                result = new int;
                 *result = sum;
-                return result;     
-            }
-            else
-            {
-                return NULL;
             }
+            delete[] visitedNodes;
+            delete[] nodeCost;
+            return result;
         }
         
         #pragma endregion métodos grafo de matríz
@@ -370,81 +525,147 @@ class Graph
         int lEdgeWeight(int nodeFrom, int nodeTo)
         {
             int weight = 0;
+            lFindEdge(nodeFrom, nodeTo, weight);
+            return weight;
+        }
+
+        /// @brief Busca la primera arista entre los nodos. Si existe, guarda su peso en weight y retorna true.
+        /// Si se eligió un índice de aristas lo usa; si no, recorre la lista del nodo hasta encontrarla.
+        bool lFindEdge(int nodeFrom, int nodeTo, int & weight)
+        {
+            if(_edgeIndexType != NO_EDGE_INDEX)
+            {
+                if(_edgeIndex == NULL)
+                {
+                    _edgeIndex = new EdgeIndex(getCSR(), _edgeIndexType);
+                }
+                return _edgeIndex->find(nodeFrom, nodeTo, weight);
+            }
+            bool found = false;
             Iterator<Edge> * iter = lAdjacents(nodeFrom);
-            while (iter->hasNext())
+            while (iter->hasNext() && !found)
             {
                 Edge e = iter->next();
                 if(e.to == nodeTo)
                 {
                     weight = e.weight;
+                    found = true;
                 }
             }
-            return weight;
+            delete iter;
+            return found;
         }
 
-        /// @brief Realiza el recorrido por anchura del grafo, aplicándole a cada nodo
-        // la función enviada por parámetro.
-        /// @param nodeFrom El nodo desde donde comienza la recorrida.
-        /// @param function La función que se ejecuta sobre cada nodo.
-        void lBfSearch(int nodeFrom, std::function<void(int, int)> f)
+        /// @brief Realiza el recorrido por anchura sobre las listas, llamando a los métodos del visitante.
+        /// Cada nodo se marca al descubrirlo, así que se descubre una única vez.
+        template <class V>
+        void lBreadthFirst(int nodeFrom, V & visitor, bool * visitedNodes)
         {
-            bool visitedNodes[_totalNodes+1];
-            for(int i = 1; i <= _totalNodes; visitedNodes[i++] = false);            
-            Queue<Tuple<int, int>> nodesQueue = Queue<Tuple<int,int>>();
-            nodesQueue.enqueue(Tuple<int,int>(nodeFrom, 0));
-            while (!nodesQueue.isEmpty())
-            {                
-                Tuple<int,int> tuple = nodesQueue.front();
-                nodesQueue.dequeue();
-                int node = tuple.first;
-                int step = tuple.second;
-                visitedNodes[node] = true;
-                f(node, step);                
-                Iterator<Edge> * iter = lAdjacents(node);
-                while (iter->hasNext())
+            int * nodesQueue = new int[_totalNodes];
+            int * depths = new int[_totalNodes+1];
+            int queueBegin = 0;
+            int queueEnd = 0;
+            visitedNodes[nodeFrom] = true;
+            depths[nodeFrom] = 0;
+            nodesQueue[queueEnd++] = nodeFrom;
+            bool running = visitor.discoverNode(nodeFrom, 0);
+            while (running && queueBegin < queueEnd)
+            {
+                int node = nodesQueue[queueBegin++];
+                List<Edge>::Cursor adjacents = _edgesArray[node].getCursor();
+                while (running && adjacents.hasNext())
                 {
-                    Edge edge = iter->next();
-                    if(!visitedNodes[edge.to])
+                    const Edge & edge = adjacents.next();
+                    if(visitor.examineEdge(node, edge.to, edge.weight) && !visitedNodes[edge.to])
                     {
-                        nodesQueue.enqueue(Tuple<int,int>(edge.to, step + 1));
+                        visitedNodes[edge.to] = true;
+                        depths[edge.to] = depths[node] + 1;
+                        nodesQueue[queueEnd++] = edge.to;
+                        running = visitor.discoverNode(edge.to, depths[edge.to]);
                     }
                 }
-                delete iter;
+                if(running)
+                {
+                    visitor.finishNode(node);
+                }
             }
+            delete[] nodesQueue;
+            delete[] depths;
         }
 
-        void lDfSearch(int nodeFrom, std::function<void(int)> f,  bool * visitedNodes)
+        /// @brief Realiza el recorrido en profundidad sobre las listas con una pila explícita de cursores, en el
+        /// mismo orden que la versión recursiva, para que los caminos largos no desborden la pila de llamadas.
+        template <class V>
+        void lDepthFirst(int nodeFrom, V & visitor, bool * visitedNodes)
         {
+            int * nodesStack = new int[_totalNodes+1];
+            List<Edge>::Cursor * cursorsStack = new List<Edge>::Cursor[_totalNodes+1];
+            int stackSize = 0;
             visitedNodes[nodeFrom] = true;
-            f(nodeFrom);
-            Iterator<Edge> * adjacents = lAdjacents(nodeFrom);
-            while (adjacents->hasNext())
+            nodesStack[stackSize] = nodeFrom;
+            cursorsStack[stackSize++] = _edgesArray[nodeFrom].getCursor();
+            bool running = visitor.discoverNode(nodeFrom, 0);
+            while (running && stackSize > 0)
             {
-                int adjacentNode = adjacents->next().to;
-                if(!visitedNodes[adjacentNode])
+                int node = nodesStack[stackSize-1];
+                List<Edge>::Cursor & adjacents = cursorsStack[stackSize-1];
+                if(!adjacents.hasNext())
                 {
-                    lDfSearch(adjacentNode, f, visitedNodes);
+                    visitor.finishNode(node);
+                    stackSize--;
+                    continue;
+                }
+                const Edge & edge = adjacents.next();
+                if(visitor.examineEdge(node, edge.to, edge.weight) && !visitedNodes[edge.to])
+                {
+                    visitedNodes[edge.to] = true;
+                    nodesStack[stackSize] = edge.to;
+                    cursorsStack[stackSize++] = _edgesArray[edge.to].getCursor();
+                    running = visitor.discoverNode(edge.to, stackSize - 1);
                 }
             }
+            delete[] nodesStack;
+            delete[] cursorsStack;
         }
 
         bool lHasPath(int nodeFrom, int nodeTo, int * visitedNodes)
         {
-            bool hasPath = nodeFrom == nodeTo;
-            if(!hasPath)
+            if(nodeFrom == nodeTo)
             {
-                visitedNodes[nodeFrom] = true;
-                Iterator<Edge> * adjacents = lAdjacents(nodeFrom);
-                while (adjacents->hasNext() && !hasPath)
+                return true;
+            }
+            Iterator<Edge> ** iteratorsStack = new Iterator<Edge> *[_totalNodes+1];
+            int stackSize = 0;
+            bool hasPath = false;
+            visitedNodes[nodeFrom] = true;
+            iteratorsStack[stackSize++] = lAdjacents(nodeFrom);
+            while (stackSize > 0 && !hasPath)
+            {
+                Iterator<Edge> * adjacents = iteratorsStack[stackSize-1];
+                if(!adjacents->hasNext())
                 {
-                    int adjacentNode = adjacents->next().to;
-                    if(!visitedNodes[adjacentNode])
-                    {
-                        hasPath = lHasPath(adjacentNode, nodeTo, visitedNodes);
-                    }
+                    delete adjacents;
+                    stackSize--;
+                    continue;
+                }
+                int adjacentNode = adjacents->next().to;
+                if(adjacentNode == nodeTo)
+                {
+                    hasPath = true;
+                }
+                else if(!visitedNodes[adjacentNode])
+                {
+                    visitedNodes[adjacentNode] = true;
+                    iteratorsStack[stackSize++] = lAdjacents(adjacentNode);
                 }
             }
-            return hasPath;            
+            // Si se encontró el camino antes de terminar, quedan iteradores en la pila.
+            while (stackSize > 0)
+            {
+                delete iteratorsStack[--stackSize];
+            }
+            delete[] iteratorsStack;
+            return hasPath;
         }
 
         /// @brief Retorna una lista con el órden topológico de los nodos, ordenados
@@ -458,13 +679,13 @@ class Graph
             {
                 return resultList;
             }
-            int nodesInDegreeAuxArray[_totalNodes+1];
+            int * nodesInDegreeAuxArray = new int[_totalNodes+1];
             // Se copia el arreglo para no modificar el global.
             for(int i = 1; i <= _totalNodes; i++)
             {
                 nodesInDegreeAuxArray[i] = _nodesInDegreeArray[i];
             }
-            Heap<int> * ceroInDegreeNodesHeap = getCeroInDegreeNodes();
+            Heap<int, MinComparator<int> > * ceroInDegreeNodesHeap = getCeroInDegreeNodes();
             int visitedNodesCount = 0;
             while (!ceroInDegreeNodesHeap->isEmpty())
             {
@@ -485,6 +706,7 @@ class Graph
                 delete iter;
             }
             delete ceroInDegreeNodesHeap;
+            delete[] nodesInDegreeAuxArray;
             if(visitedNodesCount < _totalNodes)
             {
                 resultList->clear();
@@ -501,12 +723,14 @@ class Graph
 
         /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro, comenzando desde el origen.
         /// Precondición: el grafo es ponderado con pesos de arista no negativos.
-        Stack<int> * lDijkstra(int from, int to)
+        /// @param unvisitedNodes Cola de prioridad indexada vacía (IndexedPQueue, RadixHeap o BucketQueue).
+        template <class Q>
+        Stack<int> * lDijkstra(int from, int to, Q & unvisitedNodes)
         {
             Stack<int> * path = new Stack<int>();
-            bool visitedNodes[_totalNodes+1];
-            int previousNode[_totalNodes+1]; // indica el nodo previo al nodo [i].
-            int fromCostTo[_totalNodes+1]; // representa el costo desde el nodo "from" hasta el nodo [i].
+            bool * visitedNodes = new bool[_totalNodes+1];
+            int * previousNode = new int[_totalNodes+1]; // indica el nodo previo al nodo [i].
+            int * fromCostTo = new int[_totalNodes+1]; // representa el costo desde el nodo "from" hasta el nodo [i].
             for (int i = 1; i <= _totalNodes; i++)
             {
                 visitedNodes[i] = false;
@@ -514,7 +738,6 @@ class Graph
                 fromCostTo[i] = INT32_MAX;
             }
             fromCostTo[from] = 0;
-            PQueue<int> unvisitedNodes = PQueue<int>(_totalNodes+_totalEdges); // Cola de prioridad ordenada por menor costo.
             unvisitedNodes.enqueue(from, 0);
             while (!unvisitedNodes.isEmpty())
             {
@@ -525,19 +748,18 @@ class Graph
                     visitedNodes[node] = true;
                     if(node != to)
                     {
-                        Iterator<Edge> * iter = lAdjacents(node);
-                        while(iter->hasNext())
+                        List<Edge>::Cursor adjacents = _edgesArray[node].getCursor();
+                        while(adjacents.hasNext())
                         {
-                            Edge e = iter->next();
+                            const Edge & e = adjacents.next();
                             int adjacentNode = e.to;
                             if(!visitedNodes[adjacentNode] && fromCostTo[adjacentNode] > fromCostTo[node] + e.weight)
                             {
                                 previousNode[adjacentNode] = node;
                                 fromCostTo[adjacentNode] = fromCostTo[node] + e.weight;
-                                unvisitedNodes.enqueue(adjacentNode, fromCostTo[node] + e.weight);
+                                unvisitedNodes.enqueueOrDecreaseKey(adjacentNode, fromCostTo[node] + e.weight);
                             }
                         }
-                        delete iter;
                     }
                 }
             }
@@ -552,22 +774,26 @@ class Graph
                     path->push(node);
                 }
             }
+            delete[] visitedNodes;
+            delete[] previousNode;
+            delete[] fromCostTo;
             return path;
         }
 
         /// @brief Retorna el coste asociado al árbol de cubrimiento mínimo del grafo,
         /// o retorna null si no se encontró uno.
-        int * lprim(int from)
+        /// @param nodesQueue Cola de prioridad indexada vacía (IndexedPQueue o BucketQueue).
+        template <class Q>
+        int * lprim(int from, Q & nodesQueue)
         {
-            bool visitedNodes[_totalNodes+1];
-            int nodeCost[_totalNodes+1];
+            bool * visitedNodes = new bool[_totalNodes+1];
+            int * nodeCost = new int[_totalNodes+1];
             for (int i = 1; i <= _totalNodes; i++)
             {
                 visitedNodes[i] = false;
                 nodeCost[i] = INT32_MAX;
             }
             nodeCost[from] = 0;
-            PQueue<int> nodesQueue = PQueue<int>(_totalNodes + _totalEdges);
             nodesQueue.enqueue(from, 0);
             int visitedNodesCount = 0;
 
@@ -579,21 +805,20 @@ class Graph
                 {
                     visitedNodesCount++;
                     visitedNodes[node] = true;
-                    Iterator<Edge> * iter = lAdjacents(node);
-
-                    while (iter->hasNext())
+                    List<Edge>::Cursor adjacents = _edgesArray[node].getCursor();
+                    while (adjacents.hasNext())
                     {
-                        Edge e = iter->next();
+                        const Edge & e = adjacents.next();
                         int adjacentNode = e.to;
                         if(!visitedNodes[adjacentNode] && nodeCost[adjacentNode] > e.weight)
                         {
                             nodeCost[adjacentNode] = e.weight;
-                            nodesQueue.enqueue(adjacentNode, e.weight);
+                            nodesQueue.enqueueOrDecreaseKey(adjacentNode, e.weight);
                         }
                     }
-                    delete iter;
                 }                
             }
+            int * result = NULL;
             if(visitedNodesCount == _totalNodes)
             {
                 int sum = 0;
@@ -601,14 +826,12 @@ class Graph
                 {
                     sum+= nodeCost[i];
                 }
-                int * result = new int;
+                result = new int;
                 *result = sum;
-                return result;     
-            }
-            else
-            {
-                return NULL;
             }
+            delete[] visitedNodes;
+            delete[] nodeCost;
+            return result;
         }
 
         #pragma endregion region métodos grafo de listas de aydacencia      
@@ -623,6 +846,12 @@ class Graph
         {
             _totalNodes = totalNodes;
             _totalEdges = 0;
+            _maxWeight = 0;
+            _csrGraph = NULL;
+            _reverseCsrGraph = NULL;
+            _pointToPointSearch = NULL;
+            _edgeIndexType = NO_EDGE_INDEX;
+            _edgeIndex = NULL;
             _isDirected = isDirected;
             _isWeighted = isWeighted;
             _isDense = isDense;
@@ -646,19 +875,13 @@ class Graph
 
         ~Graph()
         {
+            invalidateCSR();
             delete[] _nodesInDegreeArray;
             delete[] _nodesOutDegreeArray;
             if(_isDense)
             {
-                for(int i = 1; i <= _totalNodes; i++)
-                {
-                    for (int j = 1; j <= _totalNodes; j++)
-                    {
-                        delete _edgesMatrix[i][j];
-                    } 
-                    delete[] _edgesMatrix[i];
-                }
                 delete[] _edgesMatrix;
+                delete[] _adjacencyBits;
             }
             else
             {
@@ -675,6 +898,12 @@ class Graph
         /// @param weight Peso de la arista.
         void addEdge(int nodeFrom, int nodeTo, int weight = 1)
         {
+            invalidateCSR();
+            int storedWeight = _isWeighted ? weight : 1;
+            if(storedWeight > _maxWeight)
+            {
+                _maxWeight = storedWeight;
+            }
             if(_isDense)
             {
                 mAddEdge(nodeFrom, nodeTo, weight);
@@ -700,34 +929,222 @@ class Graph
             }
         }
 
-        /// @brief Realiza el recorrido por anchura del grafo, aplicándole a cada nodo
-        // la función enviada por parámetro.
+        /// @brief Retorna true si existe una arista desde nodeFrom hasta nodeTo.
+        bool hasEdge(int nodeFrom, int nodeTo)
+        {
+            if(nodeFrom < 1 || nodeFrom > _totalNodes || nodeTo < 1 || nodeTo > _totalNodes)
+            {
+                return false;
+            }
+            if(_isDense)
+            {
+                return (_adjacencyBits[(size_t)nodeFrom * _wordsPerRow + nodeTo / 64] >> (nodeTo % 64)) & 1ULL;
+            }
+            int weight;
+            return lFindEdge(nodeFrom, nodeTo, weight);
+        }
+
+        /// @brief Elige cómo se buscan las aristas en modo de listas, en edgeWeight y hasEdge.
+        /// Sin índice (NO_EDGE_INDEX) se recorre la lista del nodo. Con SORTED_ADJACENCY o HASH_INDEX,
+        /// el índice se construye en la primera búsqueda y se reconstruye si se agregan aristas.
+        /// En modo de matriz no tiene efecto, porque la búsqueda ya es O(1).
+        void setEdgeIndex(EdgeIndexType type)
+        {
+            if(type != _edgeIndexType)
+            {
+                delete _edgeIndex;
+                _edgeIndex = NULL;
+                _edgeIndexType = _isDense ? NO_EDGE_INDEX : type;
+            }
+        }
+
+        /// @brief Realiza el recorrido por anchura del grafo, llamando a los métodos del visitante (ver GraphVisitor).
+        /// Los nodos se descubren nivel por nivel y, dentro de cada nivel, en el orden de las aristas.
         /// @param nodeFrom El nodo desde donde comienza la recorrida.
-        /// @param function La función que se ejecuta sobre cada nodo.
-        void bfSearch(int nodeFrom, std::function<void(int, int)> f)
+        template <class V>
+        void breadthFirstVisit(int nodeFrom, V & visitor)
         {
+            bool * visitedNodes = new bool[_totalNodes+1];
+            for (int i = 1; i <= _totalNodes; visitedNodes[i++] = false);
             if(_isDense)
             {
-                mBfSearch(nodeFrom, f);
+                mBreadthFirst(nodeFrom, visitor, visitedNodes);
             }
             else
             {
-                lBfSearch(nodeFrom, f);
+                lBreadthFirst(nodeFrom, visitor, visitedNodes);
             }
+            delete[] visitedNodes;
         }
 
-        void dfSearch(int nodeFrom, std::function<void(int)> f)
+        /// @brief Realiza el recorrido por anchura del grafo, aplicándole a cada nodo y su nivel
+        /// la función enviada por parámetro.
+        /// Acepta cualquier función o lambda, que el compilador puede inlinear en el recorrido.
+        /// @param nodeFrom El nodo desde donde comienza la recorrida.
+        /// @param f La función que se ejecuta sobre cada nodo.
+        template <class F>
+        void bfSearch(int nodeFrom, F f)
+        {
+            DiscoverVisitor<F> visitor(f);
+            breadthFirstVisit(nodeFrom, visitor);
+        }
+
+        /// @brief Versión de bfSearch con std::function, que se conserva por compatibilidad.
+        void bfSearch(int nodeFrom, std::function<void(int, int)> f)
+        {
+            DiscoverVisitor<std::function<void(int, int)> > visitor(f);
+            breadthFirstVisit(nodeFrom, visitor);
+        }
+
+        /// @brief Realiza el recorrido por anchura del grafo con varios hilos, de dirección optimizada,
+        /// y luego le aplica a cada nodo alcanzado la función enviada por parámetro, nivel por nivel
+        /// y en orden creciente dentro de cada nivel.
+        /// @param nodeFrom El nodo desde donde comienza la recorrida.
+        /// @param f La función que se ejecuta sobre cada nodo y su nivel, o NULL.
+        /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+        /// @param parents Si no es NULL, arreglo de totalNodes + 1 posiciones donde se guarda el padre de cada
+        /// nodo en el árbol del recorrido. El del origen es él mismo y el de los nodos no alcanzados es 0.
+        /// @param depths Si no es NULL, arreglo de totalNodes + 1 posiciones donde se guarda el nivel de cada nodo,
+        /// o -1 si no fue alcanzado.
+        void parallelBfSearch(int nodeFrom, std::function<void(int, int)> f, int threads, int * parents = NULL, int * depths = NULL)
+        {
+            int * parentsArray = parents != NULL ? parents : new int[_totalNodes+1];
+            int * depthsArray = depths != NULL ? depths : new int[_totalNodes+1];
+            ParallelBFS search(getCSR(), getReverseCSR(), threads);
+            int levels = search.search(nodeFrom, parentsArray, depthsArray);
+            if(f)
+            {
+                // Se ordenan los nodos por nivel con un counting sort.
+                int * levelStart = new int[levels+1];
+                int * nodesByLevel = new int[_totalNodes];
+                for (int i = 0; i <= levels; levelStart[i++] = 0);
+                for (int i = 1; i <= _totalNodes; i++)
+                {
+                    if(depthsArray[i] >= 0)
+                    {
+                        levelStart[depthsArray[i]+1]++;
+                    }
+                }
+                for (int i = 1; i <= levels; i++)
+                {
+                    levelStart[i] += levelStart[i-1];
+                }
+                int reachedNodes = levelStart[levels];
+                for (int i = 1; i <= _totalNodes; i++)
+                {
+                    if(depthsArray[i] >= 0)
+                    {
+                        nodesByLevel[levelStart[depthsArray[i]]++] = i;
+                    }
+                }
+                for (int i = 0; i < reachedNodes; i++)
+                {
+                    f(nodesByLevel[i], depthsArray[nodesByLevel[i]]);
+                }
+                delete[] levelStart;
+                delete[] nodesByLevel;
+            }
+            if(parents == NULL)
+            {
+                delete[] parentsArray;
+            }
+            if(depths == NULL)
+            {
+                delete[] depthsArray;
+            }
+        }
+
+        /// @brief Realiza el recorrido en profundidad del grafo, llamando a los métodos del visitante (ver GraphVisitor).
+        /// Las aristas de cada nodo se siguen en orden, como en la versión recursiva, pero con una pila explícita.
+        /// @param nodeFrom El nodo desde donde comienza la recorrida.
+        template <class V>
+        void depthFirstVisit(int nodeFrom, V & visitor)
         {
-            bool visitedNodes[_totalNodes+1];
+            bool * visitedNodes = new bool[_totalNodes+1];
             for (int i = 1; i <= _totalNodes; visitedNodes[i++] = false);
             if(_isDense)
             {
-                lDfSearch(nodeFrom, f, visitedNodes);
+                mDepthFirst(nodeFrom, visitor, visitedNodes);
             }
             else
             {
-                lDfSearch(nodeFrom, f, visitedNodes);
+                lDepthFirst(nodeFrom, visitor, visitedNodes);
             }
+            delete[] visitedNodes;
+        }
+
+        /// @brief Realiza el recorrido en profundidad del grafo, aplicándole a cada nodo
+        /// la función enviada por parámetro.
+        /// Acepta cualquier función o lambda, que el compilador puede inlinear en el recorrido.
+        template <class F>
+        void dfSearch(int nodeFrom, F f)
+        {
+            auto discover = [&f](int node, int) { f(node); };
+            DiscoverVisitor<decltype(discover)> visitor(discover);
+            depthFirstVisit(nodeFrom, visitor);
+        }
+
+        /// @brief Versión de dfSearch con std::function, que se conserva por compatibilidad.
+        void dfSearch(int nodeFrom, std::function<void(int)> f)
+        {
+            auto discover = [&f](int node, int) { f(node); };
+            DiscoverVisitor<decltype(discover)> visitor(discover);
+            depthFirstVisit(nodeFrom, visitor);
+        }
+
+        /// @brief Calcula las componentes fuertemente conexas del grafo.
+        /// @param component Arreglo de totalNodes + 1 posiciones donde se guarda la componente de cada nodo,
+        /// numeradas desde 1 en orden topológico inverso.
+        /// @return La cantidad de componentes.
+        int stronglyConnectedComponents(int * component)
+        {
+            return ConnectedComponents::strong(getCSR(), component);
+        }
+
+        /// @brief Calcula con varios hilos las componentes conexas del grafo, ignorando la dirección de las aristas.
+        /// @param component Arreglo de totalNodes + 1 posiciones donde se guarda la componente de cada nodo,
+        /// identificada por el menor nodo que contiene.
+        /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+        /// @return La cantidad de componentes.
+        int weaklyConnectedComponents(int * component, int threads = 0)
+        {
+            return ConnectedComponents::weak(getCSR(), component, threads);
+        }
+
+        /// @brief Calcula una renumeración de los nodos que mejora la localidad de los recorridos.
+        /// Con toCSR(reordering) se obtiene el grafo renumerado, y con la renumeración se traducen sus resultados.
+        /// @param window Cantidad de nodos recientes que compara WINDOW_LOCALITY. Si es menor a 1, se usa 5.
+        Reordering * reordering(ReorderingType type, int window = 0)
+        {
+            return Reordering::compute(getCSR(), type, window);
+        }
+
+        /// @brief Retorna una vista CSR del grafo con los nodos renumerados.
+        /// @param threads Cantidad de hilos para construirla.
+        CSRGraph * toCSR(const Reordering & reordering, int threads = 1)
+        {
+            return reordering.apply(getCSR(), threads);
+        }
+
+        /// @brief Retorna un arreglo de totalNodes + 1 posiciones con el PageRank de cada nodo, que suman 1.
+        /// @param damping Probabilidad de seguir una arista en lugar de saltar a un nodo al azar.
+        /// @param tolerance Se detiene cuando la suma de los cambios de una iteración es menor a este valor.
+        /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+        double * pageRank(double damping = 0.85, double tolerance = 1e-9, int maxIterations = 100, int threads = 0)
+        {
+            PageRank ranking(getCSR(), getReverseCSR(), threads);
+            ranking.compute(damping, tolerance, maxIterations);
+            return copyRanks(ranking);
+        }
+
+        /// @brief Igual que pageRank, pero los saltos al azar van a los nodos con probabilidad proporcional
+        /// a personalization, un arreglo de totalNodes + 1 posiciones de valores no negativos.
+        double * personalizedPageRank(const double * personalization, double damping = 0.85, double tolerance = 1e-9,
+                                      int maxIterations = 100, int threads = 0)
+        {
+            PageRank ranking(getCSR(), getReverseCSR(), threads);
+            ranking.computePersonalized(personalization, damping, tolerance, maxIterations);
+            return copyRanks(ranking);
         }
 
         /// @brief Retorna una lista con el órden topológico de los nodos, ordenados
@@ -746,29 +1163,264 @@ class Graph
             }
         }        
 
+        /// @brief Retorna una vista comprimida e inmutable del grafo, que no refleja las aristas que se agreguen después.
+        /// Si la vista CSR ya está construida, se codifica desde ella en paralelo. Si no, las aristas se codifican
+        /// a medida que se recorren, sin construir la vista CSR.
+        /// @param threads Cantidad de hilos para codificar desde la vista CSR. Si es menor a 1, se usa la cantidad de núcleos.
+        CompressedGraph * toCompressed(int threads = 0)
+        {
+            if(_csrGraph != NULL)
+            {
+                return new CompressedGraph(*_csrGraph, threads);
+            }
+            CompressedGraph::Builder builder(_isDirected);
+            for (int i = 1; i <= _totalNodes; i++)
+            {
+                if(_isDense)
+                {
+                    mAdjacents(i, [&](int adjacentNode, int weight)
+                    {
+                        builder.addEdge(i, adjacentNode, weight);
+                    });
+                }
+                else
+                {
+                    List<Edge>::Cursor adjacents = _edgesArray[i].getCursor();
+                    while (adjacents.hasNext())
+                    {
+                        const Edge & edge = adjacents.next();
+                        builder.addEdge(i, edge.to, edge.weight);
+                    }
+                }
+            }
+            return builder.build(_totalNodes);
+        }
+
+        /// @brief Calcula en paralelo el orden topológico por niveles y el camino crítico del grafo.
+        /// A diferencia de topoSort, los nodos de cada nivel no quedan ordenados por numeración.
+        /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+        /// @return Los niveles, o NULL si el grafo no es dirigido o tiene algún ciclo.
+        /// Precondición: los pesos de los caminos entran en un int.
+        Wavefront * wavefrontTopoSort(int threads = 0)
+        {
+            Wavefront * wavefront = new Wavefront(getCSR(), threads);
+            if(!wavefront->compute())
+            {
+                delete wavefront;
+                return NULL;
+            }
+            return wavefront;
+        }
+
+        /// @brief Retorna una vista inmutable del grafo en formato CSR, que no depende del grafo
+        /// y no refleja las aristas que se agreguen después.
+        /// @param threads Cantidad de hilos para construirla.
+        CSRGraph * toCSR(int threads = 1)
+        {
+            int totalArcs = 0;
+            for (int i = 1; i <= _totalNodes; i++)
+            {
+                totalArcs += _isDense ? _nodesOutDegreeArray[i] : _edgesArray[i].size();
+            }
+            int * from = new int[totalArcs > 0 ? totalArcs : 1];
+            int * to = new int[totalArcs > 0 ? totalArcs : 1];
+            int * weights = new int[totalArcs > 0 ? totalArcs : 1];
+            int arc = 0;
+            for (int i = 1; i <= _totalNodes; i++)
+            {
+                if(_isDense)
+                {
+                    mAdjacents(i, [&](int adjacentNode, int weight)
+                    {
+                        from[arc] = i;
+                        to[arc] = adjacentNode;
+                        weights[arc++] = weight;
+                    });
+                }
+                else
+                {
+                    Iterator<Edge> * iter = lAdjacents(i);
+                    while (iter->hasNext())
+                    {
+                        Edge e = iter->next();
+                        from[arc] = e.from;
+                        to[arc] = e.to;
+                        weights[arc++] = e.weight;
+                    }
+                    delete iter;
+                }
+            }
+            CSRGraph * csr = new CSRGraph(_totalNodes, totalArcs, from, to, weights, _isDirected, threads);
+            delete[] from;
+            delete[] to;
+            delete[] weights;
+            return csr;
+        }
+
         /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro.
         /// Precondición: el grafo es ponderado con pesos de arista no negativos.
-        Stack<int> * dijkstra(int from, int to)
+        /// @param queueType La cola de prioridad a utilizar. Las colas enteras evitan comparar en un heap:
+        /// RADIX_HEAP conviene con rangos de pesos grandes, BUCKET_QUEUE con pesos máximos pequeños.
+        Stack<int> * dijkstra(int from, int to, PriorityQueueType queueType = BINARY_HEAP)
+        {
+            if(queueType == RADIX_HEAP)
+            {
+                RadixHeap unvisitedNodes(_totalNodes);
+                return dijkstra(from, to, unvisitedNodes);
+            }
+            else if(queueType == BUCKET_QUEUE)
+            {
+                BucketQueue unvisitedNodes(_totalNodes, _maxWeight);
+                return dijkstra(from, to, unvisitedNodes);
+            }
+            else
+            {
+                IndexedPQueue<int> unvisitedNodes(_totalNodes);
+                return dijkstra(from, to, unvisitedNodes);
+            }
+        }
+
+        /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro con Dijkstra bidireccional,
+        /// que busca a la vez desde ambos extremos y explora bastante menos nodos que dijkstra.
+        /// Si no hay camino, retorna un stack vacío.
+        /// Precondición: el grafo es ponderado con pesos de arista no negativos.
+        Stack<int> * bidirectionalDijkstra(int from, int to)
+        {
+            return getPointToPointSearch().bidirectionalDijkstra(from, to);
+        }
+
+        /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro con A*.
+        /// Si no hay camino, retorna un stack vacío.
+        /// Precondición: el grafo es ponderado con pesos de arista no negativos.
+        /// @param heuristic Función que retorna una cota inferior de la distancia desde cada nodo hasta el destino,
+        /// como la distancia en línea recta entre coordenadas o una cota por landmarks.
+        Stack<int> * aStar(int from, int to, std::function<int(int)> heuristic)
+        {
+            return getPointToPointSearch().aStar(from, to, heuristic);
+        }
+
+        /// @brief Retorna la cantidad de nodos asentados en la última llamada a bidirectionalDijkstra o aStar.
+        int lastSettledNodes() const
+        {
+            return _pointToPointSearch != NULL ? _pointToPointSearch->settledNodes() : 0;
+        }
+
+        /// @brief Calcula las distancias entre todos los pares de nodos con Floyd-Warshall por bloques y varios hilos.
+        /// Conviene para grafos densos, donde reemplaza a una llamada a dijkstra por cada par.
+        /// Precondición: el grafo es ponderado con pesos de arista no negativos.
+        /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+        /// @param withNextHops Indica si se guarda el siguiente nodo de cada camino, para reconstruirlos con path.
+        AllPairsShortestPaths * allPairsShortestPaths(int threads = 0, bool withNextHops = false)
+        {
+            AllPairsShortestPaths * result = new AllPairsShortestPaths(_totalNodes, withNextHops);
+            for (int i = 1; i <= _totalNodes; i++)
+            {
+                if(_isDense)
+                {
+                    mAdjacents(i, [&](int adjacentNode, int weight)
+                    {
+                        result->addEdge(i, adjacentNode, weight);
+                    });
+                }
+                else
+                {
+                    Iterator<Edge> * iter = lAdjacents(i);
+                    while (iter->hasNext())
+                    {
+                        Edge e = iter->next();
+                        result->addEdge(e.from, e.to, e.weight);
+                    }
+                    delete iter;
+                }
+            }
+            result->solve(threads);
+            return result;
+        }
+
+        /// @brief Preprocesa el grafo en una jerarquía de contracción, que responde consultas de camino más corto
+        /// mucho más rápido que dijkstra y puede guardarse en un archivo. No refleja las aristas que se agreguen después.
+        /// Precondición: el grafo es ponderado con pesos de arista no negativos.
+        ContractionHierarchy * toContractionHierarchy()
+        {
+            return new ContractionHierarchy(getCSR());
+        }
+
+        /// @brief Calcula con varios hilos la distancia más corta desde un nodo hasta todos los demás,
+        /// con delta-stepping sobre la vista CSR del grafo.
+        /// Precondición: el grafo es ponderado con pesos de arista no negativos.
+        /// @param distances Arreglo de totalNodes + 1 posiciones para las distancias. Los nodos no alcanzados quedan en INT32_MAX.
+        /// @param predecessors Si no es NULL, arreglo de totalNodes + 1 posiciones para el predecesor de cada nodo
+        /// en un camino más corto. El del origen es él mismo y el de los nodos no alcanzados es 0.
+        /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+        /// @param delta Ancho de los baldes. Si es menor a 1, se elige según los pesos y el grado promedio.
+        void shortestPaths(int from, int * distances, int * predecessors = NULL, int threads = 0, int delta = 0)
+        {
+            int * predecessorsArray = predecessors != NULL ? predecessors : new int[_totalNodes+1];
+            DeltaStepping search(getCSR(), delta, threads);
+            search.search(from, distances, predecessorsArray);
+            if(predecessors == NULL)
+            {
+                delete[] predecessorsArray;
+            }
+        }
+
+        /// @brief Retorna el coste asociado al árbol de cubrimiento mínimo del grafo,
+        /// o retorna null si no se encontró uno.
+        /// @param queueType La cola de prioridad a utilizar. Como las prioridades de Prim no son monótonas,
+        /// RADIX_HEAP no es aplicable y se utiliza BINARY_HEAP en su lugar.
+        int * prim(int from, PriorityQueueType queueType = BINARY_HEAP)
+        {
+            if(queueType == BUCKET_QUEUE)
+            {
+                BucketQueue nodesQueue(_totalNodes, _maxWeight);
+                return prim(from, nodesQueue);
+            }
+            else
+            {
+                IndexedPQueue<int> nodesQueue(_totalNodes);
+                return prim(from, nodesQueue);
+            }
+        }
+
+        /// @brief Retorna el bosque de cubrimiento mínimo con sus aristas y su peso total, con Kruskal.
+        /// Si el grafo es dirigido, se ignora la dirección de las aristas.
+        SpanningForest * kruskal()
+        {
+            return MinimumSpanningForest::kruskal(getCSR());
+        }
+
+        /// @brief Retorna el bosque de cubrimiento mínimo con sus aristas y su peso total, con Borůvka y varios hilos.
+        /// Si el grafo es dirigido, se ignora la dirección de las aristas.
+        /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+        SpanningForest * boruvka(int threads = 0)
+        {
+            return MinimumSpanningForest::boruvka(getCSR(), threads);
+        }
+
+    private:
+        template <class Q>
+        Stack<int> * dijkstra(int from, int to, Q & unvisitedNodes)
         {
             if(_isDense)
             {
-                return mDijkstra(from, to);
+                return mDijkstra(from, to, unvisitedNodes);
             }
             else
             {
-                return lDijkstra(from, to);
+                return lDijkstra(from, to, unvisitedNodes);
             }
         }
 
-        int * prim(int from)
+        template <class Q>
+        int * prim(int from, Q & nodesQueue)
         {
             if(_isDense)
             {
-                return mprim(from);
+                return mprim(from, nodesQueue);
             }
             else
             {
-                return lprim(from);
+                return lprim(from, nodesQueue);
             }
         }
         
@@ -0,0 +1,457 @@
+#ifndef GRAPHIO_H
+#define GRAPHIO_H
+
+#include <fcntl.h> // Para mapear los archivos en memoria.
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fstream>
+
+#include "compressedgraph.h"
+#include "csrgraph.h"
+#include "threadpool.h"
+
+/// @brief Implementa la carga de grafos desde archivos, sin pasar por Graph::addEdge.
+/// Las listas de aristas en texto se mapean en memoria y se leen por tramos en paralelo, y los grafos
+/// se pueden guardar en un formato binario que se mapea en memoria y se recorre sin copiarlo.
+/// Los grafos comprimidos se pueden leer de una lista de aristas ordenada sin pasar por CSR, y también se
+/// pueden guardar y mapear en memoria.
+class GraphIO
+{
+private:
+    /// @brief Identifica los archivos binarios de grafos ("CSR1").
+    static const int FILE_MAGIC = 0x31525343;
+    static const int HEADER_SIZE = 4;
+    /// @brief Identifica los archivos binarios de grafos comprimidos ("CMP1"), cuyo encabezado tiene
+    /// COMPRESSED_HEADER_SIZE enteros de 64 bits.
+    static const long long COMPRESSED_MAGIC = 0x31504D43;
+    static const int COMPRESSED_HEADER_SIZE = 6;
+    /// @brief Cantidad de tramos del archivo de texto por hilo, para repartir mejor las líneas largas.
+    static const int CHUNKS_PER_THREAD = 4;
+
+    /// @brief Arreglo de enteros que crece a medida que se le agregan elementos.
+    class IntBuffer
+    {
+    public:
+        int *data;
+        size_t size;
+        size_t capacity;
+
+        IntBuffer() : data(NULL), size(0), capacity(0) {}
+
+        ~IntBuffer()
+        {
+            delete[] data;
+        }
+
+        void add(int element)
+        {
+            if (size == capacity)
+            {
+                capacity = capacity > 0 ? 2 * capacity : 1024;
+                int *newData = new int[capacity];
+                for (size_t i = 0; i < size; i++)
+                {
+                    newData[i] = data[i];
+                }
+                delete[] data;
+                data = newData;
+            }
+            data[size++] = element;
+        }
+    };
+
+    /// @brief Aristas leídas de un tramo del archivo de texto.
+    class Chunk
+    {
+    public:
+        IntBuffer from;
+        IntBuffer to;
+        IntBuffer weights;
+        int maxNode;
+        bool isValid;
+
+        Chunk() : maxNode(0), isValid(true) {}
+    };
+
+    /// @brief Mapea el archivo completo en memoria, de sólo lectura. Retorna MAP_FAILED si no se pudo.
+    /// Un archivo vacío no se puede mapear, y en ese caso retorna NULL con size en 0.
+    static void *mapFile(const char *fileName, size_t &size)
+    {
+        size = 0;
+        int file = open(fileName, O_RDONLY);
+        if (file < 0)
+        {
+            return MAP_FAILED;
+        }
+        struct stat status;
+        void *data = MAP_FAILED;
+        if (fstat(file, &status) == 0)
+        {
+            size = (size_t)status.st_size;
+            data = size == 0 ? NULL : mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0);
+        }
+        // El mapeo sigue siendo válido después de cerrar el archivo.
+        close(file);
+        return data;
+    }
+
+    static bool isBlank(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == ',';
+    }
+
+    /// @brief Lee un entero desde position, salteando los espacios previos, y retorna la posición siguiente.
+    /// Retorna NULL si no hay un entero en la línea o si no entra en un int.
+    static const char *parseInt(const char *position, const char *end, int &value)
+    {
+        while (position < end && isBlank(*position))
+        {
+            position++;
+        }
+        bool isNegative = position < end && *position == '-';
+        if (isNegative)
+        {
+            position++;
+        }
+        if (position == end || *position < '0' || *position > '9')
+        {
+            return NULL;
+        }
+        long long result = 0;
+        while (position < end && *position >= '0' && *position <= '9')
+        {
+            result = result * 10 + (*position++ - '0');
+            if (result > INT32_MAX)
+            {
+                return NULL;
+            }
+        }
+        value = (int)(isNegative ? -result : result);
+        return position;
+    }
+
+    /// @brief Lee las líneas "origen destino [peso]" de [begin, end) y aplica onEdge(from, to, weight) a cada
+    /// una, hasta que retorne false. Las líneas vacías y las que comienzan con '#' o '%' son comentarios.
+    /// Lo que sigue a los números de cada línea se ignora.
+    /// @return false si alguna línea no es válida o onEdge retornó false.
+    template <class F>
+    static bool parseLines(const char *begin, const char *end, bool isWeighted, int nodeShift, F onEdge)
+    {
+        const char *position = begin;
+        while (position < end)
+        {
+            while (position < end && isBlank(*position))
+            {
+                position++;
+            }
+            if (position < end && *position != '\n' && *position != '#' && *position != '%')
+            {
+                int from;
+                int to;
+                int weight = 1;
+                position = parseInt(position, end, from);
+                position = position != NULL ? parseInt(position, end, to) : NULL;
+                if (position != NULL && isWeighted)
+                {
+                    position = parseInt(position, end, weight);
+                }
+                if (position == NULL || from > INT32_MAX - nodeShift || to > INT32_MAX - nodeShift ||
+                    from + nodeShift < 1 || to + nodeShift < 1 || !onEdge(from + nodeShift, to + nodeShift, weight))
+                {
+                    return false;
+                }
+            }
+            while (position < end && *position++ != '\n');
+        }
+        return true;
+    }
+
+    static void parseChunk(const char *begin, const char *end, bool isWeighted, int nodeShift, Chunk &chunk)
+    {
+        chunk.isValid = parseLines(begin, end, isWeighted, nodeShift, [&](int from, int to, int weight)
+        {
+            chunk.from.add(from);
+            chunk.to.add(to);
+            if (isWeighted)
+            {
+                chunk.weights.add(weight);
+            }
+            chunk.maxNode = from > chunk.maxNode ? from : chunk.maxNode;
+            chunk.maxNode = to > chunk.maxNode ? to : chunk.maxNode;
+            return true;
+        });
+    }
+
+    template <class E>
+    static bool writeArray(std::ofstream &file, const E *data, size_t size)
+    {
+        file.write(reinterpret_cast<const char *>(data), (std::streamsize)(sizeof(E) * size));
+        return file.good();
+    }
+
+public:
+    /// @brief Lee un grafo desde una lista de aristas en texto, con una arista "origen destino [peso]" por línea.
+    /// El archivo se mapea en memoria y se divide en tramos que terminan en un fin de línea, que se leen en
+    /// paralelo. La cantidad de nodos es el mayor nodo que aparece en el archivo.
+    /// Para un grafo no dirigido, cada línea agrega la arista en ambos sentidos, como Graph::addEdge.
+    /// @param isWeighted Indica si cada línea tiene un peso. Si no, todas las aristas pesan 1.
+    /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+    /// @param isZeroBased Indica si los nodos del archivo se numeran desde 0, y se les suma 1 al leerlos.
+    /// @return El grafo, o NULL si el archivo no existe, alguna línea no es válida o hay más aristas de las que
+    /// entran en un int.
+    static CSRGraph *readEdgeList(const char *fileName, bool isDirected, bool isWeighted, int threads = 0, bool isZeroBased = false)
+    {
+        size_t size;
+        void *data = mapFile(fileName, size);
+        if (data == MAP_FAILED)
+        {
+            return NULL;
+        }
+        const char *text = static_cast<const char *>(data);
+        if (size > 0)
+        {
+            madvise(data, size, MADV_SEQUENTIAL);
+        }
+
+        ThreadPool pool(threads);
+        int totalChunks = pool.size() * CHUNKS_PER_THREAD;
+        // Cada tramo comienza después del primer fin de línea a partir de su parte proporcional del archivo.
+        size_t *chunkBegin = new size_t[totalChunks + 1];
+        chunkBegin[0] = 0;
+        chunkBegin[totalChunks] = size;
+        for (int c = 1; c < totalChunks; c++)
+        {
+            size_t position = size / totalChunks * c;
+            position = position > chunkBegin[c - 1] ? position : chunkBegin[c - 1];
+            while (position > 0 && position < size && text[position - 1] != '\n')
+            {
+                position++;
+            }
+            chunkBegin[c] = position;
+        }
+        Chunk *chunks = new Chunk[totalChunks];
+        int nodeShift = isZeroBased ? 1 : 0;
+        pool.parallelFor(0, totalChunks, [&](int begin, int end, int)
+        {
+            for (int c = begin; c < end; c++)
+            {
+                parseChunk(text + chunkBegin[c], text + chunkBegin[c + 1], isWeighted, nodeShift, chunks[c]);
+            }
+        }, 1);
+        if (size > 0)
+        {
+            munmap(data, size);
+        }
+
+        // Posición de las aristas de cada tramo en el arreglo completo.
+        size_t *edgesBegin = new size_t[totalChunks + 1];
+        edgesBegin[0] = 0;
+        int totalNodes = 0;
+        bool isValid = true;
+        for (int c = 0; c < totalChunks; c++)
+        {
+            edgesBegin[c + 1] = edgesBegin[c] + chunks[c].from.size * (isDirected ? 1 : 2);
+            totalNodes = chunks[c].maxNode > totalNodes ? chunks[c].maxNode : totalNodes;
+            isValid = isValid && chunks[c].isValid;
+        }
+        CSRGraph *graph = NULL;
+        if (isValid && edgesBegin[totalChunks] <= (size_t)INT32_MAX)
+        {
+            int totalEdges = (int)edgesBegin[totalChunks];
+            int *from = new int[totalEdges > 0 ? totalEdges : 1];
+            int *to = new int[totalEdges > 0 ? totalEdges : 1];
+            int *weights = isWeighted ? new int[totalEdges > 0 ? totalEdges : 1] : NULL;
+            pool.parallelFor(0, totalChunks, [&](int begin, int end, int)
+            {
+                for (int c = begin; c < end; c++)
+                {
+                    size_t edge = edgesBegin[c];
+                    for (size_t i = 0; i < chunks[c].from.size; i++)
+                    {
+                        from[edge] = chunks[c].from.data[i];
+                        to[edge] = chunks[c].to.data[i];
+                        if (isWeighted)
+                        {
+                            weights[edge] = chunks[c].weights.data[i];
+                        }
+                        edge++;
+                        if (!isDirected)
+                        {
+                            from[edge] = chunks[c].to.data[i];
+                            to[edge] = chunks[c].from.data[i];
+                            if (isWeighted)
+                            {
+                                weights[edge] = chunks[c].weights.data[i];
+                            }
+                            edge++;
+                        }
+                    }
+                }
+            }, 1);
+            // Se liberan las aristas de los tramos antes de construir el grafo, que necesita su propia copia.
+            delete[] chunks;
+            chunks = NULL;
+            graph = new CSRGraph(totalNodes, totalEdges, from, to, weights, isDirected, pool.size());
+            delete[] from;
+            delete[] to;
+            delete[] weights;
+        }
+        delete[] chunks;
+        delete[] chunkBegin;
+        delete[] edgesBegin;
+        return graph;
+    }
+
+    /// @brief Guarda el grafo en formato binario: un encabezado con el identificador del formato, la cantidad
+    /// de nodos, la cantidad de aristas y si es dirigido, seguido de los índices, los destinos y los pesos.
+    /// Retorna false si no se pudo escribir.
+    static bool writeBinary(const CSRGraph &graph, const char *fileName)
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        int header[HEADER_SIZE] = {FILE_MAGIC, graph.totalNodes(), graph.totalEdges(), graph.isDirected() ? 1 : 0};
+        return writeArray(file, header, HEADER_SIZE) && writeArray(file, graph.offsets(), (size_t)graph.totalNodes() + 2) &&
+               writeArray(file, graph.targets(), (size_t)graph.totalEdges()) &&
+               writeArray(file, graph.weights(), (size_t)graph.totalEdges());
+    }
+
+    /// @brief Mapea en memoria un grafo guardado con writeBinary. Los arreglos del grafo apuntan directamente
+    /// al archivo, por lo que no se copia nada y el sistema operativo carga las páginas a medida que se recorren.
+    /// El archivo se desmapea al destruir el grafo.
+    /// @return El grafo, o NULL si el archivo no existe o no es válido.
+    static CSRGraph *mapBinary(const char *fileName)
+    {
+        size_t size;
+        void *data = mapFile(fileName, size);
+        if (data == MAP_FAILED || data == NULL)
+        {
+            return NULL;
+        }
+        const int *header = static_cast<const int *>(data);
+        bool isValid = size >= HEADER_SIZE * sizeof(int) && header[0] == FILE_MAGIC && header[1] >= 0 &&
+                       header[2] >= 0 && (header[3] == 0 || header[3] == 1) &&
+                       size == sizeof(int) * (HEADER_SIZE + (size_t)header[1] + 2 + 2 * (size_t)header[2]);
+        const int *offsets = header + HEADER_SIZE;
+        const int *targets = isValid ? offsets + (size_t)header[1] + 2 : NULL;
+        // Se valida todo el archivo para que un archivo dañado no lleve a leer fuera de los arreglos.
+        for (int u = 0; isValid && u <= header[1]; u++)
+        {
+            isValid = offsets[u] <= offsets[u + 1];
+        }
+        isValid = isValid && offsets[0] == 0 && offsets[1] == 0 && offsets[header[1] + 1] == header[2];
+        for (int e = 0; isValid && e < header[2]; e++)
+        {
+            isValid = targets[e] >= 1 && targets[e] <= header[1];
+        }
+        if (!isValid)
+        {
+            munmap(data, size);
+            return NULL;
+        }
+        return CSRGraph::view(header[1], header[2], offsets, targets, targets + header[2], header[3] == 1,
+                              [data, size]() { munmap(data, size); });
+    }
+
+    /// @brief Lee un grafo comprimido desde una lista de aristas en texto, con el formato de readEdgeList, sin
+    /// armar la lista de aristas ni la vista CSR: el archivo mapeado se lee una sola vez, en orden, y cada
+    /// arista se codifica al leerla, así que sólo ocupa memoria el grafo comprimido.
+    /// Las líneas deben estar agrupadas por origen, con los orígenes en orden creciente. Para un grafo no
+    /// dirigido, el archivo debe tener cada arista en ambos sentidos.
+    /// @return El grafo, o NULL si el archivo no existe, alguna línea no es válida o los orígenes no están en orden.
+    static CompressedGraph *readCompressedEdgeList(const char *fileName, bool isDirected, bool isWeighted, bool isZeroBased = false)
+    {
+        size_t size;
+        void *data = mapFile(fileName, size);
+        if (data == MAP_FAILED)
+        {
+            return NULL;
+        }
+        const char *text = static_cast<const char *>(data);
+        if (size > 0)
+        {
+            madvise(data, size, MADV_SEQUENTIAL);
+        }
+        CompressedGraph::Builder builder(isDirected);
+        bool isValid = parseLines(text, text + size, isWeighted, isZeroBased ? 1 : 0, [&](int from, int to, int weight)
+        {
+            return builder.addEdge(from, to, weight);
+        });
+        if (size > 0)
+        {
+            munmap(data, size);
+        }
+        return isValid ? builder.build() : NULL;
+    }
+
+    /// @brief Guarda el grafo comprimido en formato binario: un encabezado de enteros de 64 bits con el
+    /// identificador del formato, la cantidad de nodos, de aristas y de bytes, si es dirigido y si tiene pesos,
+    /// seguido de los índices de bytes, los índices de aristas, los pesos si los tiene y los bytes.
+    /// Retorna false si no se pudo escribir.
+    static bool writeBinary(const CompressedGraph &graph, const char *fileName)
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        long long header[COMPRESSED_HEADER_SIZE] = {COMPRESSED_MAGIC, graph.totalNodes(), graph.totalEdges(),
+                                                    (long long)graph.totalBytes(), graph.isDirected() ? 1 : 0,
+                                                    graph.weights() != NULL ? 1 : 0};
+        size_t totalOffsets = (size_t)graph.totalNodes() + 2;
+        return writeArray(file, header, COMPRESSED_HEADER_SIZE) && writeArray(file, graph.byteOffsets(), totalOffsets) &&
+               writeArray(file, graph.edgeOffsets(), totalOffsets) &&
+               (graph.weights() == NULL || writeArray(file, graph.weights(), (size_t)graph.totalEdges())) &&
+               writeArray(file, graph.bytes(), graph.totalBytes());
+    }
+
+    /// @brief Mapea en memoria un grafo comprimido guardado con writeBinary, sin copiarlo. El archivo se valida
+    /// completo, decodificando los adyacentes, y se desmapea al destruir el grafo.
+    /// @return El grafo, o NULL si el archivo no existe o no es válido.
+    static CompressedGraph *mapCompressed(const char *fileName)
+    {
+        size_t size;
+        void *data = mapFile(fileName, size);
+        if (data == MAP_FAILED || data == NULL)
+        {
+            return NULL;
+        }
+        const long long *header = static_cast<const long long *>(data);
+        size_t headerBytes = COMPRESSED_HEADER_SIZE * sizeof(long long);
+        bool isValid = size >= headerBytes && header[0] == COMPRESSED_MAGIC && header[1] >= 0 && header[1] < INT32_MAX &&
+                       header[2] >= 0 && header[3] >= 0 && (header[4] == 0 || header[4] == 1) &&
+                       (header[5] == 0 || header[5] == 1);
+        // Se compara el tamaño por partes, para que un encabezado dañado no desborde la cuenta.
+        size_t remaining = isValid ? size - headerBytes : 0;
+        size_t offsetsBytes = isValid ? ((size_t)header[1] + 2) * (sizeof(size_t) + sizeof(long long)) : 0;
+        isValid = isValid && remaining >= offsetsBytes;
+        remaining = isValid ? remaining - offsetsBytes : 0;
+        isValid = isValid && (header[5] == 0 || (size_t)header[2] <= remaining / sizeof(int));
+        size_t weightsBytes = isValid && header[5] == 1 ? (size_t)header[2] * sizeof(int) : 0;
+        isValid = isValid && remaining - weightsBytes == (size_t)header[3];
+        int totalNodes = isValid ? (int)header[1] : 0;
+        const size_t *byteOffsets = reinterpret_cast<const size_t *>(header + COMPRESSED_HEADER_SIZE);
+        const long long *edgeOffsets = reinterpret_cast<const long long *>(byteOffsets + totalNodes + 2);
+        const int *weights = reinterpret_cast<const int *>(edgeOffsets + totalNodes + 2);
+        const unsigned char *bytes = reinterpret_cast<const unsigned char *>(weights) + weightsBytes;
+        isValid = isValid && byteOffsets[0] == 0 && byteOffsets[1] == 0 && edgeOffsets[0] == 0 && edgeOffsets[1] == 0 &&
+                  byteOffsets[totalNodes + 1] == (size_t)header[3] && edgeOffsets[totalNodes + 1] == header[2];
+        for (int u = 1; isValid && u <= totalNodes; u++)
+        {
+            isValid = byteOffsets[u] <= byteOffsets[u + 1] && edgeOffsets[u] <= edgeOffsets[u + 1];
+        }
+        CompressedGraph *graph = NULL;
+        if (isValid)
+        {
+            graph = CompressedGraph::view(totalNodes, header[2], header[4] == 1, byteOffsets, edgeOffsets, bytes,
+                                          header[5] == 1 ? weights : NULL, [data, size]() { munmap(data, size); });
+            if (!graph->isValid())
+            {
+                delete graph;
+                graph = NULL;
+            }
+        }
+        else
+        {
+            munmap(data, size);
+        }
+        return graph;
+    }
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef GRAPHVISITOR_H
+#define GRAPHVISITOR_H
+
+/// @brief Visitante de los recorridos de Graph (breadthFirstVisit y depthFirstVisit).
+/// Se hereda y se redefinen sólo los métodos que se usan. Los recorridos son templates sobre el tipo del
+/// visitante, así que los métodos no son virtuales: el compilador los resuelve en tiempo de compilación y los
+/// que no se redefinen, que están vacíos, no cuestan nada.
+class GraphVisitor
+{
+public:
+    /// @brief Se llama cuando el recorrido llega por primera vez al nodo.
+    /// @param depth Cantidad de aristas desde el origen: el nivel en anchura, o la profundidad en la pila en profundidad.
+    /// @return false para terminar el recorrido.
+    bool discoverNode(int, int)
+    {
+        return true;
+    }
+
+    /// @brief Se llama por cada arista que sale de un nodo descubierto, aunque el destino ya se haya visitado.
+    /// @return false para no seguir la arista.
+    bool examineEdge(int, int, int)
+    {
+        return true;
+    }
+
+    /// @brief Se llama cuando se terminaron de examinar las aristas del nodo.
+    void finishNode(int)
+    {
+    }
+};
+
+/// @brief Visitante que aplica f(node, depth) a cada nodo descubierto, para los recorridos con una función.
+template <class F>
+class DiscoverVisitor : public GraphVisitor
+{
+private:
+    F &_f;
+
+public:
+    explicit DiscoverVisitor(F &f) : _f(f) {}
+
+    bool discoverNode(int node, int depth)
+    {
+        _f(node, depth);
+        return true;
+    }
+};
+
+#endif
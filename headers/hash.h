@@ -27,7 +27,7 @@ class HashTable
 
         float loadFactor() const
         {
-            return (_population/_size);
+            return ((float)_population / _size);
         }
 
         bool wasBucketRemoved(int index) const
@@ -43,6 +43,15 @@ class HashTable
             Bucket* * oldTable = _table;
             _size = nextPrime(oldSize*2);
             _table = new Bucket*[_size];
+            delete[] _removedBucketsMap;
+            _removedBucketsMap = new bool[_size];
+            for (int i = 0; i < _size; i++)
+            {
+                _table[i] = NULL;
+                _removedBucketsMap[i] = false;
+            }
+            // add vuelve a contar cada bucket que se redistribuye.
+            _population = 0;
             for (int i = 0; i < oldSize; i++)
             {
                 if(oldTable[i] != NULL)
@@ -52,8 +61,6 @@ class HashTable
                 delete oldTable[i];
                 oldTable[i] = NULL;
             }
-            delete[] _removedBucketsMap;
-            _removedBucketsMap = new bool[_size];
             delete[] oldTable;
             oldTable = NULL;
         }
@@ -73,13 +80,14 @@ class HashTable
 
         /// @brief Utiliza el método de redistribución cuadrática para obtener el índice del bucket.
         /// @param i el número de iteraciones hechas hasta el momento para encontrar un bucket libre.
+        /// Se calcula sin signo, para que un hash negativo o una suma que desborda no den un índice negativo.
         int calculateIndex(K key, int i) const {
-            return ((_hash(key) + i*i) % _size);
+            return (int)(((unsigned int)_hash(key) + (unsigned int)i*i) % (unsigned int)_size);
         }
 
         /// @brief Retorna el índice en la tabla de hash según la clave dada. 
         /// Si la clave no está en la tabla retorna -1.
-        int getIndexByKey(const K key)
+        int getIndexByKey(const K key) const
         {   
             int tries = 0;
             int candidateIndex = calculateIndex(key, tries);
@@ -96,13 +104,15 @@ class HashTable
             return -1;
         }
         
+        /// @brief Retorna el menor primo mayor o igual a top, probando divisores hasta su raíz.
+        /// Se compara i con top / i en lugar de i * i con top, que desborda cerca de INT32_MAX.
         int nextPrime(int top) 
         {
             if (top > 1) {
-                for (int i = 2; i <= top/2; i++) {
+                for (int i = 2; i <= top / i; i++) {
                     if (top % i == 0) {
                         top++;
-                        i = 2;
+                        i = 1;
                     };
                 };
             };
@@ -133,6 +143,11 @@ class HashTable
         /// Si la clave ya existía, retorna false y el método no tiene efecto.
         bool add(K key, V value)
         {
+            // La clave puede estar después de un bucket eliminado, que es el primer lugar libre.
+            if(getIndexByKey(key) > -1)
+            {
+                return false;
+            }
             int tries = 0;
             int candidateIndex = calculateIndex(key, tries);
             while (_table[candidateIndex] != NULL) 
@@ -167,7 +182,7 @@ class HashTable
             }
         }
 
-        bool tryGetValue(const K key, V &outValue)
+        bool tryGetValue(const K key, V &outValue) const
         {
             bool found = false;
             int index = getIndexByKey(key);
@@ -184,7 +199,7 @@ class HashTable
             bool found = false;
             for (int i = 0; i < _size && !found; i++)
             {
-                found = (_table[i]->value == value);
+                found = (_table[i] != NULL && _table[i]->value == value);
             }
             return found;
         }
@@ -3,87 +3,149 @@
 
 enum Type {MAX , MIN};
 
-/// @brief Implementa un heap max o min según se especifique, de tipo de dato T.
-/// @tparam T 
+/// @brief Comparador de un minheap: el menor elemento queda en el tope.
 template <class T>
+class MinComparator
+{
+public:
+    bool operator()(const T &a, const T &b) const
+    {
+        return a < b;
+    }
+};
+
+/// @brief Comparador de un maxheap: el mayor elemento queda en el tope.
+template <class T>
+class MaxComparator
+{
+public:
+    bool operator()(const T &a, const T &b) const
+    {
+        return a > b;
+    }
+};
+
+/// @brief Comparador que decide en tiempo de ejecución si el heap es MIN o MAX.
+/// Es el comparador por defecto sólo por compatibilidad con el constructor Heap(size, type): paga una
+/// comparación del tipo en cada paso de swim y sink. El código nuevo debe usar MinComparator o MaxComparator.
+template <class T>
+class TypeComparator
+{
+private:
+    Type _type;
+
+public:
+    explicit TypeComparator(Type type = MIN) : _type(type) {}
+
+    bool operator()(const T &a, const T &b) const
+    {
+        return _type == MAX ? a > b : a < b;
+    }
+};
+
+/// @brief Implementa un heap d-ario de tipo de dato T que crece según sea necesario.
+/// @tparam T
+/// @tparam Comparator Retorna true si el primer elemento debe quedar más cerca del tope que el segundo.
+/// Al conocerse en tiempo de compilación, las comparaciones se resuelven en línea.
+/// @tparam Arity Cantidad de hijos de cada nodo (2, 4 u 8). Un heap de mayor aridad es menos profundo
+/// y los hijos de cada nodo comparten líneas de caché.
+/// @note Como en el resto de las estructuras, no se utiliza el índice 0 del arreglo.
+template <class T, class Comparator = TypeComparator<T>, int Arity = 2>
 class Heap
 {
+    static_assert(Arity >= 2, "La aridad del heap debe ser al menos 2.");
+
 private:
+    static const int DEFAULT_SIZE = 16;
+
     T *_array;
     int _population;
     int _size;
-    Type _type;
+    Comparator _comparator;
 
     void free()
     {
         delete[] _array;
-    }    
+    }
 
-    void swap(int minElementIndex, int maxElementIndex)
+    static int parentIndex(int index)
     {
-        if (minElementIndex != maxElementIndex)
-        {
-            T maxElementValue = _array[maxElementIndex];
-            T minElementValue = _array[minElementIndex];
+        return (index - 2) / Arity + 1;
+    }
 
-            _array[minElementIndex] = maxElementValue;
-            _array[maxElementIndex] = minElementValue;
+    static int firstChildIndex(int index)
+    {
+        return Arity * (index - 1) + 2;
+    }
+
+    /// @brief Duplica la capacidad del arreglo, conservando sus elementos.
+    void grow()
+    {
+        int newSize = 2 * _size;
+        T *newArray = new T[newSize];
+        for (int i = 1; i <= _population; i++)
+        {
+            newArray[i] = _array[i];
         }
-    } 
+        free();
+        _array = newArray;
+        _size = newSize;
+    }
 
     void swim(int index)
     {
-        int parentIndex = (int)index / 2;
-        while (parentIndex > 0 && index > 0 && 
-        ((_type == MAX) ? _array[parentIndex] < _array[index] : _array[parentIndex] > _array[index]))
+        // Se desplazan los padres hacia abajo y el elemento se escribe una única vez al final.
+        T element = _array[index];
+        while (index > 1 && _comparator(element, _array[parentIndex(index)]))
         {
-            swap(index, parentIndex);
-
-            index = parentIndex;
-            parentIndex = (int)index / 2;
+            _array[index] = _array[parentIndex(index)];
+            index = parentIndex(index);
         }
+        _array[index] = element;
     }
 
     void sink(int index)
     {
-        int leftChildIndex = index * 2;
-        int rightChildIndex = index * 2 + 1;
-
-        bool needToSink = true;
+        T element = _array[index];
+        int childIndex = firstChildIndex(index);
 
-        while (needToSink && index <= _population)
+        while (childIndex <= _population)
         {
-            int topElementIndex = index;
-
-            if (leftChildIndex <= _population &&
-                (_type == MAX ? _array[leftChildIndex] > _array[index] : _array[leftChildIndex] < _array[index]))
+            int lastChildIndex = childIndex + Arity - 1 < _population ? childIndex + Arity - 1 : _population;
+            int topElementIndex = childIndex;
+            for (int i = childIndex + 1; i <= lastChildIndex; i++)
             {
-
-                topElementIndex = leftChildIndex;
-
-                if (rightChildIndex <= _population &&
-                    (_type == MAX ? _array[rightChildIndex] > _array[topElementIndex] : _array[rightChildIndex] < _array[topElementIndex]))
+                if (_comparator(_array[i], _array[topElementIndex]))
                 {
-
-                    topElementIndex = rightChildIndex;
+                    topElementIndex = i;
                 }
             }
-            else if (rightChildIndex <= _population &&
-                     (_type == MAX ? _array[rightChildIndex] > _array[index] : _array[rightChildIndex] < _array[index]))
-            {
-                topElementIndex = rightChildIndex;
-            }
-            else
+
+            if (!_comparator(_array[topElementIndex], element))
             {
-                needToSink = false;
+                break;
             }
 
-            swap(index, topElementIndex);
-
+            _array[index] = _array[topElementIndex];
             index = topElementIndex;
+            childIndex = firstChildIndex(index);
+        }
+        _array[index] = element;
+    }
 
-            leftChildIndex = index * 2;
-            rightChildIndex = index * 2 + 1;
+    void heapify(const T *elements, int count)
+    {
+        _population = count > 0 ? count : 0;
+        _size = (_population > 0 ? _population : 1) + 1;
+        _array = new T[_size];
+        for (int i = 0; i < _population; i++)
+        {
+            _array[i + 1] = elements[i];
+        }
+        // Las hojas ya son heaps, se hunden los nodos internos desde el último hasta la raíz.
+        for (int i = _population > 1 ? parentIndex(_population) : 0; i >= 1; i--)
+        {
+            sink(i);
         }
     }
 
@@ -94,19 +156,52 @@ private:
 
 public:
 
-    Heap(){}
-    
+    Heap()
+    {
+        _size = DEFAULT_SIZE + 1;
+        _population = 0;
+        _array = new T[_size];
+    }
+
     /// @brief Crea un heap dado un tamaño, y su tipo.
-    /// @param size Cantidad de elmentos que podrá alojar el heap.
+    /// Sólo está disponible con el comparador por defecto y se mantiene por compatibilidad:
+    /// Heap<T, MinComparator<T> >(size) o Heap<T, MaxComparator<T> >(size) evitan decidir el tipo en cada comparación.
+    /// @param size Cantidad de elementos que podrá alojar el heap antes de crecer.
     /// @param type MIN o MAX para construir un minheap o maxheap.
-    explicit Heap(int size, Type type)
+    explicit Heap(int size, Type type) : _comparator(type)
+    {
+        _size = (size > 0 ? size : 1) + 1;
+        _population = 0;
+        _array = new T[_size];
+    }
+
+    /// @brief Crea un heap dado un tamaño inicial y un comparador.
+    /// @param size Cantidad de elementos que podrá alojar el heap antes de crecer.
+    explicit Heap(int size, Comparator comparator = Comparator()) : _comparator(comparator)
     {
-        _type = type;
-        _size = size + 1;
+        _size = (size > 0 ? size : 1) + 1;
         _population = 0;
         _array = new T[_size];
     }
 
+    /// @brief Crea un heap con los elementos dados, construyéndolo de abajo hacia arriba en O(n).
+    /// Sólo está disponible con el comparador por defecto y se mantiene por compatibilidad.
+    /// @param elements Los elementos, desde la posición 0.
+    /// @param count Cantidad de elementos.
+    /// @param type MIN o MAX para construir un minheap o maxheap.
+    explicit Heap(const T *elements, int count, Type type) : _comparator(type)
+    {
+        heapify(elements, count);
+    }
+
+    /// @brief Crea un heap con los elementos dados, construyéndolo de abajo hacia arriba en O(n).
+    /// @param elements Los elementos, desde la posición 0.
+    /// @param count Cantidad de elementos.
+    explicit Heap(const T *elements, int count, Comparator comparator = Comparator()) : _comparator(comparator)
+    {
+        heapify(elements, count);
+    }
+
     ~Heap()
     {
         free();
@@ -117,11 +212,18 @@ public:
         return _array;
     }
 
+    int size() const
+    {
+        return _population;
+    }
+
     bool isEmpty() const
     {
         return _population == 0;
     }
 
+    /// @brief Retorna true si se ocupó la capacidad reservada.
+    /// El próximo add duplicará la capacidad.
     bool isFull() const
     {
         return _population == _size - 1;
@@ -132,20 +234,19 @@ public:
         return _array[1];
     }
 
+    /// @brief Agrega el elemento al heap, creciendo si es necesario. Siempre retorna true.
     bool add(T element)
     {
-        bool added = false;
-
-        if (!isFull())
+        if (isFull())
         {
-            _population++;
-            _array[_population] = element;
-            swim(_population);
-
-            added = true;
+            grow();
         }
 
-        return added;
+        _population++;
+        _array[_population] = element;
+        swim(_population);
+
+        return true;
     }
 
     bool removeTop()
@@ -164,6 +265,41 @@ public:
         return removed;
     }
 
+    /// @brief Sustituye el tope por el elemento dado y lo hunde, con un único recorrido.
+    /// Equivale a removeTop seguido de add. Si el heap es vacío, agrega el elemento.
+    bool replaceTop(T element)
+    {
+        if (isEmpty())
+        {
+            return add(element);
+        }
+
+        _array[1] = element;
+        sink(1);
+
+        return true;
+    }
+
+    /// @brief Ordena en el lugar los elementos del heap, dentro del mismo arreglo de getArray(),
+    /// desde la posición 1. Quedan en el orden inverso al de salida del heap: un minheap queda
+    /// de mayor a menor y un maxheap de menor a mayor. El heap queda vacío.
+    /// @return La cantidad de elementos ordenados.
+    int heapSort()
+    {
+        int count = _population;
+        while (_population > 1)
+        {
+            T topElement = _array[1];
+            _array[1] = _array[_population];
+            _array[_population] = topElement;
+
+            _population--;
+            sink(1);
+        }
+        _population = 0;
+        return count;
+    }
+
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,195 @@
+#ifndef INDEXEDPQUEUE_H
+#define INDEXEDPQUEUE_H
+
+/// @brief Implementa una cola de prioridad indexada sobre identificadores enteros de 1 a maxId,
+/// con prioridades de tipo P. El valor de prioridad menor es el más prioritario.
+/// Cada identificador está a lo sumo una vez en la cola, y un mapa de posiciones permite
+/// disminuir su prioridad o quitarlo en O(log n), por lo que la memoria es O(maxId).
+/// @note Como en el resto de las estructuras, no se utiliza el índice 0.
+template <class P>
+class IndexedPQueue
+{
+private:
+    int _population;
+    int _maxId;
+    /// @brief Heap binario de identificadores.
+    int *_heap;
+    /// @brief Posición en el heap de cada identificador, o 0 si no está en la cola.
+    int *_position;
+    /// @brief Prioridad de cada identificador que está en la cola.
+    P *_priority;
+
+    void place(int index, int id)
+    {
+        _heap[index] = id;
+        _position[id] = index;
+    }
+
+    void swim(int index)
+    {
+        int id = _heap[index];
+        while (index > 1 && _priority[id] < _priority[_heap[index / 2]])
+        {
+            place(index, _heap[index / 2]);
+            index = index / 2;
+        }
+        place(index, id);
+    }
+
+    void sink(int index)
+    {
+        int id = _heap[index];
+        int childIndex = 2 * index;
+        while (childIndex <= _population)
+        {
+            if (childIndex < _population && _priority[_heap[childIndex + 1]] < _priority[_heap[childIndex]])
+            {
+                childIndex++;
+            }
+            if (!(_priority[_heap[childIndex]] < _priority[id]))
+            {
+                break;
+            }
+            place(index, _heap[childIndex]);
+            index = childIndex;
+            childIndex = 2 * index;
+        }
+        place(index, id);
+    }
+
+public:
+    /// @brief Crea una cola vacía para identificadores de 1 a maxId.
+    explicit IndexedPQueue(int maxId)
+    {
+        _population = 0;
+        _maxId = maxId;
+        _heap = new int[_maxId + 1];
+        _position = new int[_maxId + 1];
+        _priority = new P[_maxId + 1];
+        for (int i = 0; i <= _maxId; i++)
+        {
+            _position[i] = 0;
+        }
+    }
+
+    ~IndexedPQueue()
+    {
+        delete[] _heap;
+        delete[] _position;
+        delete[] _priority;
+    }
+
+    /// @brief Agrega el identificador a la cola con la prioridad dada.
+    /// Precondición: el identificador no está en la cola.
+    void enqueue(int id, P priority)
+    {
+        assert(id > 0 && id <= _maxId && !contains(id));
+        _population++;
+        _priority[id] = priority;
+        place(_population, id);
+        swim(_population);
+    }
+
+    /// @brief Disminuye la prioridad del identificador.
+    /// Precondición: el identificador está en la cola y la prioridad no es mayor a la actual.
+    void decreaseKey(int id, P priority)
+    {
+        assert(contains(id) && !(_priority[id] < priority));
+        _priority[id] = priority;
+        swim(_position[id]);
+    }
+
+    /// @brief Agrega el identificador o, si ya está en la cola, disminuye su prioridad.
+    void enqueueOrDecreaseKey(int id, P priority)
+    {
+        if (contains(id))
+        {
+            decreaseKey(id, priority);
+        }
+        else
+        {
+            enqueue(id, priority);
+        }
+    }
+
+    /// @brief Retorna true si el identificador está en la cola.
+    bool contains(int id) const
+    {
+        return _position[id] != 0;
+    }
+
+    /// @brief Quita el identificador de la cola. Si no está, no tiene efecto.
+    void remove(int id)
+    {
+        if (contains(id))
+        {
+            int index = _position[id];
+            int lastId = _heap[_population];
+            _population--;
+            _position[id] = 0;
+            if (lastId != id)
+            {
+                place(index, lastId);
+                swim(index);
+                sink(_position[lastId]);
+            }
+        }
+    }
+
+    /// @brief Vacía la cola en O(tamaño), sin recorrer todos los identificadores.
+    void clear()
+    {
+        for (int i = 1; i <= _population; i++)
+        {
+            _position[_heap[i]] = 0;
+        }
+        _population = 0;
+    }
+
+    /// @brief Quita de la cola al primero.
+    /// Si la cola está vacía, no tiene efecto.
+    void dequeue()
+    {
+        if (!isEmpty())
+        {
+            remove(_heap[1]);
+        }
+    }
+
+    /// @brief Retorna el identificador más prioritario.
+    /// Precondición: La cola no está vacía.
+    int front() const
+    {
+        assert(!isEmpty());
+        return _heap[1];
+    }
+
+    /// @brief Retorna la prioridad del identificador más prioritario.
+    /// Precondición: La cola no está vacía.
+    P frontPriority() const
+    {
+        assert(!isEmpty());
+        return _priority[_heap[1]];
+    }
+
+    /// @brief Retorna la prioridad del identificador.
+    /// Precondición: el identificador está en la cola.
+    P priority(int id) const
+    {
+        assert(contains(id));
+        return _priority[id];
+    }
+
+    /// @brief Retorna el tamaño actual de la cola.
+    int size() const
+    {
+        return _population;
+    }
+
+    bool isEmpty() const
+    {
+        return _population == 0;
+    }
+};
+
+#endif
@@ -0,0 +1,311 @@
+#ifndef INTERVALTREE_H
+#define INTERVALTREE_H
+
+#include "list.h"
+
+/// @brief Implementa un árbol de intervalos cerrados [low, high] de extremos de tipo T,
+/// sobre un AVL ordenado por el extremo inferior. Cada nodo guarda además el mayor extremo
+/// superior de su subárbol, que se recalcula en cada rotación, para podar las búsquedas.
+/// Las rotaciones son las de avl.h, repetidas aquí con update() para mantener ese máximo.
+/// @note El tipo T debe implementar operator< y operator<=.
+template <typename T>
+class IntervalTree
+{
+public:
+    class Interval
+    {
+    public:
+        T low;
+        T high;
+        Interval() {}
+        Interval(T low, T high) : low(low), high(high) {}
+
+        bool operator==(const Interval &o) const
+        {
+            return !(low < o.low) && !(o.low < low) && !(high < o.high) && !(o.high < high);
+        }
+
+        bool operator<(const Interval &o) const
+        {
+            return low < o.low || (!(o.low < low) && high < o.high);
+        }
+
+        bool operator<=(const Interval &o) const
+        {
+            return !(o < *this);
+        }
+    };
+
+    IntervalTree() : rootNode(NULL), _population(0) {}
+
+    ~IntervalTree()
+    {
+        destroyTree(rootNode);
+        rootNode = NULL;
+    }
+
+    void insert(T low, T high)
+    {
+        insertRec(rootNode, Interval(low, high));
+        _population++;
+    };
+
+    /// @brief Quita una ocurrencia del intervalo [low, high] del árbol.
+    /// Si el intervalo no pertenece al árbol, el método no tiene efecto.
+    void remove(T low, T high)
+    {
+        bool removed = false;
+        removeRec(rootNode, Interval(low, high), removed);
+        if (removed)
+        {
+            _population--;
+        }
+    };
+
+    int size() const
+    {
+        return _population;
+    }
+
+    bool isEmpty() const
+    {
+        return rootNode == NULL;
+    }
+
+    /// @brief Aplica la función a cada intervalo que contiene al punto dado, sin solicitar memoria.
+    /// Recorre O(min(n, (k + 1) log n)) nodos, siendo k la cantidad de intervalos encontrados:
+    /// la poda por el mayor extremo superior puede bajar por un camino de O(log n) por cada resultado.
+    template <class F>
+    void forEachStabbing(T point, F visitor) const
+    {
+        forEachOverlappingRec(rootNode, point, point, visitor);
+    }
+
+    /// @brief Aplica la función a cada intervalo que se superpone con [low, high], sin solicitar memoria.
+    /// Recorre O(min(n, (k + 1) log n)) nodos, siendo k la cantidad de intervalos encontrados.
+    template <class F>
+    void forEachOverlapping(T low, T high, F visitor) const
+    {
+        forEachOverlappingRec(rootNode, low, high, visitor);
+    }
+
+    /// @brief Retorna en una lista, en orden, los intervalos que contienen al punto dado.
+    List<Interval> *stabbing(T point) const
+    {
+        return overlapping(point, point);
+    }
+
+    /// @brief Retorna en una lista, en orden, los intervalos que se superponen con [low, high].
+    List<Interval> *overlapping(T low, T high) const
+    {
+        List<Interval> *list = new List<Interval>();
+        auto addToList = [list](const Interval &interval) { list->add(interval); };
+        forEachOverlappingRec(rootNode, low, high, addToList);
+        return list;
+    }
+
+private:
+    class IntervalNode
+    {
+    public:
+        int height;
+        Interval data;
+        /// @brief Mayor extremo superior entre los intervalos del subárbol.
+        T maxHigh;
+        IntervalNode *leftNode;
+        IntervalNode *rightNode;
+        IntervalNode(Interval data) : height(1), data(data), maxHigh(data.high), leftNode(NULL), rightNode(NULL) {}
+        ~IntervalNode() {}
+    };
+
+    IntervalNode *rootNode;
+    int _population;
+
+    template <class F>
+    static void forEachOverlappingRec(const IntervalNode *node, const T &low, const T &high, F &visitor)
+    {
+        // Si ningún intervalo del subárbol termina a partir de low, ninguno se superpone.
+        while (node != NULL && !(node->maxHigh < low))
+        {
+            forEachOverlappingRec(node->leftNode, low, high, visitor);
+            if (!(high < node->data.low))
+            {
+                if (!(node->data.high < low))
+                {
+                    visitor(node->data);
+                }
+                node = node->rightNode;
+            }
+            else
+            {
+                // Los intervalos del subárbol derecho comienzan después de high.
+                node = NULL;
+            }
+        }
+    }
+
+    void destroyTree(IntervalNode *treeNode)
+    {
+        if (treeNode != NULL)
+        {
+            destroyTree(treeNode->leftNode);
+            destroyTree(treeNode->rightNode);
+
+            delete treeNode;
+        }
+    };
+
+    int height(IntervalNode *treeNode)
+    {
+        return treeNode != NULL ? treeNode->height : 0;
+    };
+
+    int getBalance(IntervalNode *treeNode)
+    {
+        return treeNode != NULL ? height(treeNode->rightNode) - height(treeNode->leftNode) : 0;
+    };
+
+    /// @brief Recalcula la altura y el mayor extremo superior del nodo a partir de sus hijos.
+    void update(IntervalNode *treeNode)
+    {
+        treeNode->height = max(height(treeNode->leftNode), height(treeNode->rightNode)) + 1;
+        treeNode->maxHigh = treeNode->data.high;
+        if (treeNode->leftNode != NULL && treeNode->maxHigh < treeNode->leftNode->maxHigh)
+        {
+            treeNode->maxHigh = treeNode->leftNode->maxHigh;
+        }
+        if (treeNode->rightNode != NULL && treeNode->maxHigh < treeNode->rightNode->maxHigh)
+        {
+            treeNode->maxHigh = treeNode->rightNode->maxHigh;
+        }
+    };
+
+    void leftRotation(IntervalNode *&unbalancedNode)
+    {
+        IntervalNode *rightChild = unbalancedNode->rightNode;
+        IntervalNode *subtree = rightChild->leftNode;
+
+        rightChild->leftNode = unbalancedNode;
+        unbalancedNode->rightNode = subtree;
+
+        // El nodo desbalanceado queda debajo, por lo que se actualiza primero.
+        update(unbalancedNode);
+        update(rightChild);
+
+        unbalancedNode = rightChild;
+    };
+
+    void rightRotation(IntervalNode *&unbalancedNode)
+    {
+        IntervalNode *leftChild = unbalancedNode->leftNode;
+        IntervalNode *subtree = leftChild->rightNode;
+
+        leftChild->rightNode = unbalancedNode;
+        unbalancedNode->leftNode = subtree;
+
+        update(unbalancedNode);
+        update(leftChild);
+
+        unbalancedNode = leftChild;
+    };
+
+    /// @brief Actualiza el nodo y lo rebalancea según el factor de balance de sus hijos.
+    void rebalance(IntervalNode *&treeNode)
+    {
+        update(treeNode);
+
+        int balance = getBalance(treeNode);
+
+        if (balance < -1)
+        { // I
+            if (getBalance(treeNode->leftNode) > 0)
+            { // ID
+                leftRotation(treeNode->leftNode);
+            }
+            rightRotation(treeNode);
+        }
+        else if (balance > 1)
+        { // D
+            if (getBalance(treeNode->rightNode) < 0)
+            { // DI
+                rightRotation(treeNode->rightNode);
+            }
+            leftRotation(treeNode);
+        }
+    };
+
+    void insertRec(IntervalNode *&treeNode, const Interval &element)
+    {
+        if (treeNode == NULL)
+        {
+            treeNode = new IntervalNode(element);
+            return;
+        }
+
+        if (element <= treeNode->data)
+        {
+            insertRec(treeNode->leftNode, element);
+        }
+        else
+        {
+            insertRec(treeNode->rightNode, element);
+        }
+
+        rebalance(treeNode);
+    };
+
+    /// @brief Desprende el menor nodo del subárbol y lo retorna.
+    IntervalNode *detachMinRec(IntervalNode *&treeNode)
+    {
+        if (treeNode->leftNode == NULL)
+        {
+            IntervalNode *minNode = treeNode;
+            treeNode = treeNode->rightNode;
+            return minNode;
+        }
+        IntervalNode *minNode = detachMinRec(treeNode->leftNode);
+        rebalance(treeNode);
+        return minNode;
+    };
+
+    void removeRec(IntervalNode *&treeNode, const Interval &element, bool &removed)
+    {
+        if (treeNode == NULL)
+        {
+            return;
+        }
+
+        if (element < treeNode->data)
+        {
+            removeRec(treeNode->leftNode, element, removed);
+        }
+        else if (treeNode->data < element)
+        {
+            removeRec(treeNode->rightNode, element, removed);
+        }
+        else
+        {
+            IntervalNode *oldNode = treeNode;
+            if (treeNode->leftNode == NULL || treeNode->rightNode == NULL)
+            {
+                treeNode = treeNode->leftNode != NULL ? treeNode->leftNode : treeNode->rightNode;
+            }
+            else
+            {
+                IntervalNode *successor = detachMinRec(treeNode->rightNode);
+                successor->leftNode = treeNode->leftNode;
+                successor->rightNode = treeNode->rightNode;
+                treeNode = successor;
+            }
+            delete oldNode;
+            removed = true;
+        }
+
+        if (treeNode != NULL)
+        {
+            rebalance(treeNode);
+        }
+    };
+};
+
+#endif
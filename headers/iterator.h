@@ -7,6 +7,8 @@ template <class T>
 class Iterator
 {
     public:
+        /// @brief Virtual para que los iteradores se puedan liberar desde un puntero a Iterator.
+        virtual ~Iterator() {}
         virtual bool hasNext() = 0;
         virtual T next() = 0;
 };
@@ -235,6 +235,36 @@ class List
         {
             return new ListIterator(_head);
         }
+
+        /// @brief Iterador que se usa por valor: no solicita memoria y sus métodos no son virtuales,
+        /// por lo que el compilador los puede inlinear en los ciclos de recorrida.
+        class Cursor
+        {
+            private:
+                const Node *_current;
+
+            public:
+                Cursor() : _current{NULL} {}
+                explicit Cursor(const Node *current) : _current{current} {}
+
+                bool hasNext() const
+                {
+                    return _current != NULL;
+                }
+
+                const T & next()
+                {
+                    const T & element = _current->element;
+                    _current = _current->next;
+                    return element;
+                }
+        };
+
+        /// @brief Retorna un cursor situado en el primer elemento de la lista.
+        Cursor getCursor() const
+        {
+            return Cursor(_head);
+        }
     
 };
 
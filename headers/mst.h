@@ -0,0 +1,275 @@
+#ifndef MST_H
+#define MST_H
+
+#include <atomic> // Para elegir la arista mínima de cada componente desde varios hilos.
+
+#include "csrgraph.h"
+#include "threadpool.h"
+#include "unionfind.h"
+
+/// @brief Bosque de cubrimiento: las aristas elegidas y la suma de sus pesos.
+/// Si el grafo es conexo, es un árbol con totalNodes - 1 aristas.
+class SpanningForest
+{
+private:
+    int _size;
+    int _components;
+    long long _totalWeight;
+    int *_from;
+    int *_to;
+    int *_weight;
+
+public:
+    explicit SpanningForest(int totalNodes)
+    {
+        _size = 0;
+        _components = totalNodes;
+        _totalWeight = 0;
+        _from = new int[totalNodes > 0 ? totalNodes : 1];
+        _to = new int[totalNodes > 0 ? totalNodes : 1];
+        _weight = new int[totalNodes > 0 ? totalNodes : 1];
+    }
+
+    ~SpanningForest()
+    {
+        delete[] _from;
+        delete[] _to;
+        delete[] _weight;
+    }
+
+    /// @brief Agrega una arista, que une dos componentes distintas del bosque.
+    void add(int from, int to, int weight)
+    {
+        _from[_size] = from;
+        _to[_size] = to;
+        _weight[_size] = weight;
+        _size++;
+        _components--;
+        _totalWeight += weight;
+    }
+
+    /// @brief Retorna la cantidad de aristas del bosque.
+    int size() const
+    {
+        return _size;
+    }
+
+    int from(int index) const
+    {
+        return _from[index];
+    }
+
+    int to(int index) const
+    {
+        return _to[index];
+    }
+
+    int weight(int index) const
+    {
+        return _weight[index];
+    }
+
+    long long totalWeight() const
+    {
+        return _totalWeight;
+    }
+
+    /// @brief Retorna la cantidad de árboles del bosque, que es 1 si el grafo es conexo.
+    int components() const
+    {
+        return _components;
+    }
+
+    bool isTree() const
+    {
+        return _components == 1;
+    }
+};
+
+/// @brief Implementa algoritmos de bosque de cubrimiento mínimo sobre un grafo CSR.
+/// Si el grafo es dirigido, se ignora la dirección de las aristas.
+class MinimumSpanningForest
+{
+private:
+    /// @brief Aristas del grafo sin dirección: una por arista, sin lazos.
+    class EdgeArray
+    {
+    public:
+        int size;
+        int *from;
+        int *to;
+        int *weight;
+
+        explicit EdgeArray(const CSRGraph &graph)
+        {
+            int capacity = graph.totalEdges() > 0 ? graph.totalEdges() : 1;
+            from = new int[capacity];
+            to = new int[capacity];
+            weight = new int[capacity];
+            size = 0;
+            for (int i = 1; i <= graph.totalNodes(); i++)
+            {
+                for (int e = graph.edgesBegin(i); e < graph.edgesEnd(i); e++)
+                {
+                    int adjacentNode = graph.target(e);
+                    // Si no es dirigido, cada arista aparece desde ambos nodos y se toma una sola vez.
+                    if (adjacentNode != i && (graph.isDirected() || i < adjacentNode))
+                    {
+                        from[size] = i;
+                        to[size] = adjacentNode;
+                        weight[size] = graph.weight(e);
+                        size++;
+                    }
+                }
+            }
+        }
+
+        ~EdgeArray()
+        {
+            delete[] from;
+            delete[] to;
+            delete[] weight;
+        }
+    };
+
+    /// @brief Convierte el peso a un entero sin signo con el mismo orden, para ordenarlo por bytes.
+    static unsigned int weightKey(int weight)
+    {
+        return (unsigned int)weight ^ 0x80000000u;
+    }
+
+public:
+    /// @brief Retorna el bosque de cubrimiento mínimo con Kruskal: ordena las aristas por peso con un radix sort
+    /// de cuatro pasadas de un byte, y las agrega en orden si unen dos componentes distintas.
+    static SpanningForest *kruskal(const CSRGraph &graph)
+    {
+        EdgeArray edges(graph);
+        int *order = new int[edges.size > 0 ? edges.size : 1];
+        int *auxOrder = new int[edges.size > 0 ? edges.size : 1];
+        for (int i = 0; i < edges.size; i++)
+        {
+            order[i] = i;
+        }
+        for (int shift = 0; shift < 32; shift += 8)
+        {
+            int count[257];
+            for (int i = 0; i <= 256; i++)
+            {
+                count[i] = 0;
+            }
+            for (int i = 0; i < edges.size; i++)
+            {
+                count[((weightKey(edges.weight[order[i]]) >> shift) & 0xFF) + 1]++;
+            }
+            // Si todas las aristas tienen el mismo byte, la pasada no cambia el orden.
+            bool singleBucket = false;
+            for (int i = 1; i <= 256; i++)
+            {
+                singleBucket = singleBucket || count[i] == edges.size;
+                count[i] += count[i - 1];
+            }
+            if (singleBucket)
+            {
+                continue;
+            }
+            for (int i = 0; i < edges.size; i++)
+            {
+                auxOrder[count[(weightKey(edges.weight[order[i]]) >> shift) & 0xFF]++] = order[i];
+            }
+            int *aux = order;
+            order = auxOrder;
+            auxOrder = aux;
+        }
+
+        SpanningForest *forest = new SpanningForest(graph.totalNodes());
+        UnionFind components(graph.totalNodes());
+        for (int i = 0; i < edges.size && forest->components() > 1; i++)
+        {
+            int e = order[i];
+            if (components.unite(edges.from[e], edges.to[e]))
+            {
+                forest->add(edges.from[e], edges.to[e], edges.weight[e]);
+            }
+        }
+        delete[] order;
+        delete[] auxOrder;
+        return forest;
+    }
+
+    /// @brief Retorna el bosque de cubrimiento mínimo con Borůvka: en cada ronda, cada componente elige en
+    /// paralelo su arista más liviana hacia otra componente, y se agregan todas, por lo que la cantidad de
+    /// componentes al menos se divide a la mitad en cada ronda. Los empates de peso se resuelven por índice
+    /// de arista, para que las aristas elegidas no formen ciclos.
+    /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+    static SpanningForest *boruvka(const CSRGraph &graph, int threads)
+    {
+        const unsigned long long NO_EDGE = ~0ULL;
+        int totalNodes = graph.totalNodes();
+        EdgeArray edges(graph);
+        ThreadPool pool(threads);
+        SpanningForest *forest = new SpanningForest(totalNodes);
+        UnionFind components(totalNodes);
+        int *component = new int[totalNodes + 1];
+        // Peso en los 32 bits altos e índice de arista en los bajos, para elegir el mínimo con una sola operación.
+        std::atomic<unsigned long long> *cheapest = new std::atomic<unsigned long long>[totalNodes + 1];
+        for (int i = 0; i <= totalNodes; i++)
+        {
+            component[i] = i;
+        }
+
+        bool merged = true;
+        while (merged && forest->components() > 1)
+        {
+            pool.parallelFor(1, totalNodes + 1, [&](int begin, int end, int)
+            {
+                for (int i = begin; i < end; i++)
+                {
+                    cheapest[i].store(NO_EDGE, std::memory_order_relaxed);
+                }
+            });
+            pool.parallelFor(0, edges.size, [&](int begin, int end, int)
+            {
+                for (int e = begin; e < end; e++)
+                {
+                    int fromComponent = component[edges.from[e]];
+                    int toComponent = component[edges.to[e]];
+                    if (fromComponent == toComponent)
+                    {
+                        continue;
+                    }
+                    unsigned long long key = ((unsigned long long)weightKey(edges.weight[e]) << 32) | (unsigned int)e;
+                    int sides[2] = {fromComponent, toComponent};
+                    for (int s = 0; s < 2; s++)
+                    {
+                        unsigned long long current = cheapest[sides[s]].load(std::memory_order_relaxed);
+                        while (key < current && !cheapest[sides[s]].compare_exchange_weak(current, key, std::memory_order_relaxed));
+                    }
+                }
+            }, 1024);
+
+            merged = false;
+            for (int i = 1; i <= totalNodes; i++)
+            {
+                unsigned long long key = cheapest[i].load(std::memory_order_relaxed);
+                if (component[i] == i && key != NO_EDGE)
+                {
+                    int e = (int)(key & 0xFFFFFFFFULL);
+                    if (components.unite(edges.from[e], edges.to[e]))
+                    {
+                        forest->add(edges.from[e], edges.to[e], edges.weight[e]);
+                        merged = true;
+                    }
+                }
+            }
+            for (int i = 1; i <= totalNodes; i++)
+            {
+                component[i] = components.find(i);
+            }
+        }
+        delete[] component;
+        delete[] cheapest;
+        return forest;
+    }
+};
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef MULTIQUEUE_H
+#define MULTIQUEUE_H
+
+#include <atomic> // Para consultar el tope de cada heap sin tomar su lock.
+#include <mutex>
+#include <thread> // Para ceder el procesador entre recorridos completos de los heaps.
+
+#include "heap.h"
+
+/// @brief Implementa una cola de prioridad concurrente y relajada (MultiQueue) de tipo T, con
+/// prioridades de tipo P. El valor de prioridad menor es el más prioritario.
+/// Está formada por varios Heap, cada uno protegido por un lock que sólo se intenta tomar:
+/// enqueue agrega en un heap al azar, y dequeue quita el mejor tope de dos heaps al azar.
+/// No garantiza quitar el elemento más prioritario, sino uno cercano a él, a cambio de que
+/// los hilos casi nunca compitan por el mismo lock.
+/// @note P debe poder usarse en un std::atomic (por ejemplo int o float).
+template <class T, class P = int>
+class MultiQueue
+{
+private:
+    class Pair
+    {
+    public:
+        P priority;
+        T value;
+        Pair() {}
+        Pair(T value, P priority) : priority(priority), value(value) {}
+
+        bool operator<(const Pair &o) const
+        {
+            return this->priority < o.priority;
+        }
+    };
+
+    class SubQueue
+    {
+    public:
+        std::mutex lock;
+        Heap<Pair, MinComparator<Pair>, 4> heap;
+        /// @brief Copias del tope y de la población del heap, para elegir sin tomar el lock.
+        std::atomic<P> topPriority;
+        std::atomic<int> population;
+        /// @brief Separa cada heap en su propia línea de caché.
+        char padding[64];
+        SubQueue() : topPriority(P()), population(0) {}
+    };
+
+    /// @brief Mayor cantidad de intentos vacíos entre dos recorridos completos de los heaps en tryDequeue.
+    static const int MAX_TRIES_BEFORE_SCAN = 1 << 16;
+
+    int _queueCount;
+    SubQueue *_queues;
+    std::atomic<int> _population;
+
+    /// @brief Generador xorshift propio de cada hilo.
+    static unsigned int random()
+    {
+        static thread_local unsigned int state = 0;
+        if (state == 0)
+        {
+            state = (unsigned int)(size_t)&state | 1u;
+        }
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    /// @brief Actualiza las copias del tope y la población. Precondición: se tiene el lock.
+    static void publishTop(SubQueue &queue)
+    {
+        if (!queue.heap.isEmpty())
+        {
+            queue.topPriority.store(queue.heap.top().priority, std::memory_order_relaxed);
+        }
+        queue.population.store(queue.heap.size(), std::memory_order_release);
+    }
+
+    bool allEmpty() const
+    {
+        for (int i = 0; i < _queueCount; i++)
+        {
+            if (_queues[i].population.load(std::memory_order_acquire) > 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    /// @brief Crea una cola vacía.
+    /// @param threads Cantidad de hilos que la utilizarán.
+    /// @param queuesPerThread Cantidad de heaps por hilo. Más heaps reducen la competencia por los locks,
+    /// pero alejan al elemento quitado del más prioritario.
+    explicit MultiQueue(int threads, int queuesPerThread = 2)
+    {
+        _queueCount = (threads > 0 ? threads : 1) * (queuesPerThread > 0 ? queuesPerThread : 1);
+        _queues = new SubQueue[_queueCount];
+        _population = 0;
+    }
+
+    ~MultiQueue()
+    {
+        delete[] _queues;
+    }
+
+    /// @brief Agrega un elemento a un heap elegido al azar entre los que estén libres.
+    void enqueue(T value, P priority)
+    {
+        while (true)
+        {
+            SubQueue &queue = _queues[random() % _queueCount];
+            if (queue.lock.try_lock())
+            {
+                queue.heap.add(Pair(value, priority));
+                publishTop(queue);
+                queue.lock.unlock();
+                _population.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    /// @brief Quita el mejor de los topes de dos heaps elegidos al azar.
+    /// Retorna false si la cola está vacía, y en ese caso no modifica los parámetros.
+    /// @param outValue El elemento quitado.
+    /// @param outPriority Su prioridad.
+    bool tryDequeue(T &outValue, P &outPriority)
+    {
+        int emptyTries = 0;
+        int triesBeforeScan = _queueCount;
+        while (true)
+        {
+            SubQueue *first = &_queues[random() % _queueCount];
+            SubQueue *second = &_queues[random() % _queueCount];
+            bool firstEmpty = first->population.load(std::memory_order_acquire) == 0;
+            bool secondEmpty = second->population.load(std::memory_order_acquire) == 0;
+            SubQueue *best = firstEmpty || (!secondEmpty && second->topPriority.load(std::memory_order_relaxed) < first->topPriority.load(std::memory_order_relaxed))
+                ? second
+                : first;
+
+            if (firstEmpty && secondEmpty)
+            {
+                // Luego de varios intentos se recorren todos los heaps para confirmar que la cola está vacía.
+                // Si no lo está, quedan pocos elementos y otros hilos pueden estar quitándolos: se cede el procesador
+                // y se espera el doble de intentos hasta el próximo recorrido, en lugar de repetirlo en cada vuelta.
+                if (++emptyTries >= triesBeforeScan)
+                {
+                    if (allEmpty())
+                    {
+                        return false;
+                    }
+                    emptyTries = 0;
+                    triesBeforeScan = triesBeforeScan < MAX_TRIES_BEFORE_SCAN ? 2 * triesBeforeScan : triesBeforeScan;
+                    std::this_thread::yield();
+                }
+                continue;
+            }
+
+            if (best->lock.try_lock())
+            {
+                bool removed = !best->heap.isEmpty();
+                if (removed)
+                {
+                    Pair top = best->heap.top();
+                    best->heap.removeTop();
+                    publishTop(*best);
+                    outValue = top.value;
+                    outPriority = top.priority;
+                }
+                best->lock.unlock();
+                if (removed)
+                {
+                    _population.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+    }
+
+    /// @brief Retorna el tamaño aproximado de la cola, mientras otros hilos la modifican.
+    int size() const
+    {
+        return _population.load(std::memory_order_relaxed);
+    }
+
+    bool isEmpty() const
+    {
+        return allEmpty();
+    }
+};
+
+#endif
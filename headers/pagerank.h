@@ -0,0 +1,245 @@
+#ifndef PAGERANK_H
+#define PAGERANK_H
+
+#ifdef __AVX2__
+#include <immintrin.h> // Para sumar de a 4 valores del vector con instrucciones de recolección.
+#endif
+
+#include "csrgraph.h"
+#include "threadpool.h"
+
+/// @brief Implementa el producto de la matriz de adyacencia de un grafo CSR por un vector (SpMV).
+/// La fila de cada nodo son sus aristas, por lo que el producto lee las filas en orden y sólo escribe
+/// el resultado de cada fila una vez, sin sincronización entre los hilos (el esquema "pull").
+class SparseMatrixVector
+{
+private:
+    /// @brief Cantidad de filas que toma cada hilo por vez.
+    static const int ROWS_PER_TASK = 256;
+
+    /// @brief Retorna la suma de x[target(e)] * weight(e) para las aristas [begin, end).
+    static double rowProduct(const int *targets, const int *weights, int begin, int end, const double *x)
+    {
+        int e = begin;
+#ifdef __AVX2__
+        __m256d sum = _mm256_setzero_pd();
+        for (; e + 4 <= end; e += 4)
+        {
+            __m128i indexes = _mm_loadu_si128((const __m128i *)(targets + e));
+            __m256d values = _mm256_i32gather_pd(x, indexes, 8);
+            if (weights != NULL)
+            {
+                values = _mm256_mul_pd(values, _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)(weights + e))));
+            }
+            sum = _mm256_add_pd(sum, values);
+        }
+        double lanes[4];
+        _mm256_storeu_pd(lanes, sum);
+        double result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#else
+        // Cuatro sumas independientes, para que las lecturas de x no esperen a la suma anterior.
+        double sums[4] = {0, 0, 0, 0};
+        for (; e + 4 <= end; e += 4)
+        {
+            for (int lane = 0; lane < 4; lane++)
+            {
+                sums[lane] += x[targets[e + lane]] * (weights != NULL ? weights[e + lane] : 1);
+            }
+        }
+        double result = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+#endif
+        for (; e < end; e++)
+        {
+            result += x[targets[e]] * (weights != NULL ? weights[e] : 1);
+        }
+        return result;
+    }
+
+public:
+    /// @brief Calcula y = M x, donde M[u][v] es el peso de la arista de u a v, o 1 si useWeights es false.
+    /// Con el grafo transpuesto calcula y[v] = suma de x[u] sobre las aristas que llegan a v.
+    /// @param x Vector de entrada, indexado por nodo.
+    /// @param y Vector de salida, indexado por nodo. No puede ser el mismo que x.
+    static void multiply(const CSRGraph &matrix, const double *x, double *y, ThreadPool &pool, bool useWeights)
+    {
+        const int *offsets = matrix.offsets();
+        const int *targets = matrix.targets();
+        const int *weights = useWeights ? matrix.weights() : NULL;
+        pool.parallelFor(1, matrix.totalNodes() + 1, [&](int begin, int end, int)
+        {
+            for (int u = begin; u < end; u++)
+            {
+                y[u] = rowProduct(targets, weights, offsets[u], offsets[u + 1], x);
+            }
+        }, ROWS_PER_TASK);
+    }
+};
+
+/// @brief Implementa PageRank por iteración de potencias sobre el producto SpMV del grafo transpuesto:
+/// en cada iteración, el rango de cada nodo es la suma de los rangos de los nodos que lo apuntan, divididos
+/// por su grado de salida. El rango de los nodos sin aristas de salida se reparte según el vector de
+/// teletransporte, que es uniforme o, en PageRank personalizado, el dado.
+/// Se detiene cuando la suma de los cambios de los rangos en una iteración es menor a la tolerancia.
+class PageRank
+{
+private:
+    /// @brief Separación entre las sumas parciales de cada hilo, para que no compartan línea de caché.
+    static const int PADDING = 8;
+
+    const CSRGraph &_reverse;
+    int _totalNodes;
+    ThreadPool _pool;
+    /// @brief Inverso del grado de salida de cada nodo, o 0 si no tiene aristas de salida.
+    double *_inverseOutDegree;
+    double *_rank;
+    double *_nextRank;
+    /// @brief Rango de cada nodo dividido por su grado de salida: lo que aporta a cada nodo que apunta.
+    double *_contribution;
+    double *_teleport;
+    double *_partialSums;
+    int _iterations;
+
+    /// @brief Suma los valores de f(begin, end) de todos los rangos de nodos, entre los hilos.
+    template <class F>
+    double parallelSum(F f)
+    {
+        for (int worker = 0; worker < _pool.size(); worker++)
+        {
+            _partialSums[worker * PADDING] = 0;
+        }
+        double *partialSums = _partialSums;
+        _pool.parallelFor(1, _totalNodes + 1, [&](int begin, int end, int worker)
+        {
+            partialSums[worker * PADDING] += f(begin, end);
+        });
+        double sum = 0;
+        for (int worker = 0; worker < _pool.size(); worker++)
+        {
+            sum += _partialSums[worker * PADDING];
+        }
+        return sum;
+    }
+
+    int run(double damping, double tolerance, int maxIterations)
+    {
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            _rank[u] = _teleport[u];
+        }
+        _iterations = 0;
+        double change = tolerance;
+        while (_iterations < maxIterations && change >= tolerance)
+        {
+            double danglingRank = parallelSum([&](int begin, int end)
+            {
+                double sum = 0;
+                for (int u = begin; u < end; u++)
+                {
+                    _contribution[u] = _rank[u] * _inverseOutDegree[u];
+                    sum += _inverseOutDegree[u] == 0 ? _rank[u] : 0;
+                }
+                return sum;
+            });
+            SparseMatrixVector::multiply(_reverse, _contribution, _nextRank, _pool, false);
+            change = parallelSum([&](int begin, int end)
+            {
+                double sum = 0;
+                for (int v = begin; v < end; v++)
+                {
+                    _nextRank[v] = damping * _nextRank[v] + (damping * danglingRank + 1 - damping) * _teleport[v];
+                    sum += _nextRank[v] > _rank[v] ? _nextRank[v] - _rank[v] : _rank[v] - _nextRank[v];
+                }
+                return sum;
+            });
+            double *aux = _rank;
+            _rank = _nextRank;
+            _nextRank = aux;
+            _iterations++;
+        }
+        return _iterations;
+    }
+
+public:
+    /// @brief Prepara el cálculo sobre el grafo.
+    /// @param reverse El grafo transpuesto, o el mismo grafo si no es dirigido.
+    /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+    explicit PageRank(const CSRGraph &graph, const CSRGraph &reverse, int threads) : _reverse(reverse), _pool(threads)
+    {
+        _totalNodes = graph.totalNodes();
+        _inverseOutDegree = new double[_totalNodes + 1];
+        _rank = new double[_totalNodes + 1];
+        _nextRank = new double[_totalNodes + 1];
+        _contribution = new double[_totalNodes + 1];
+        _teleport = new double[_totalNodes + 1];
+        _partialSums = new double[_pool.size() * PADDING];
+        _rank[0] = _nextRank[0] = _contribution[0] = _teleport[0] = _inverseOutDegree[0] = 0;
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            _inverseOutDegree[u] = graph.outDegree(u) > 0 ? 1.0 / graph.outDegree(u) : 0;
+        }
+        _iterations = 0;
+    }
+
+    ~PageRank()
+    {
+        delete[] _inverseOutDegree;
+        delete[] _rank;
+        delete[] _nextRank;
+        delete[] _contribution;
+        delete[] _teleport;
+        delete[] _partialSums;
+    }
+
+    /// @brief Calcula el PageRank de todos los nodos, que suman 1.
+    /// @param damping Probabilidad de seguir una arista en lugar de saltar a un nodo al azar.
+    /// @param tolerance Se detiene cuando la suma de los cambios de una iteración es menor a este valor.
+    /// @return La cantidad de iteraciones realizadas.
+    int compute(double damping = 0.85, double tolerance = 1e-9, int maxIterations = 100)
+    {
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            _teleport[u] = 1.0 / _totalNodes;
+        }
+        return run(damping, tolerance, maxIterations);
+    }
+
+    /// @brief Calcula el PageRank personalizado: los saltos al azar van a los nodos con probabilidad
+    /// proporcional a personalization, que se normaliza.
+    /// Precondición: los valores no son negativos y alguno es positivo.
+    /// @return La cantidad de iteraciones realizadas.
+    int computePersonalized(const double *personalization, double damping = 0.85, double tolerance = 1e-9, int maxIterations = 100)
+    {
+        double total = 0;
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            assert(personalization[u] >= 0);
+            total += personalization[u];
+        }
+        assert(total > 0);
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            _teleport[u] = personalization[u] / total;
+        }
+        return run(damping, tolerance, maxIterations);
+    }
+
+    /// @brief Retorna el rango del nodo según el último cálculo.
+    double rank(int node) const
+    {
+        return _rank[node];
+    }
+
+    /// @brief Retorna los rangos del último cálculo, indexados por nodo.
+    const double *ranks() const
+    {
+        return _rank;
+    }
+
+    /// @brief Retorna la cantidad de iteraciones del último cálculo.
+    int iterations() const
+    {
+        return _iterations;
+    }
+};
+
+#endif
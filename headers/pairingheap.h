@@ -0,0 +1,319 @@
+#ifndef PAIRINGHEAP_H
+#define PAIRINGHEAP_H
+
+#include "heap.h"
+
+/// @brief Implementa un pairing heap de tipo T, que se puede unir con otro en O(1).
+/// insert y meld son O(1), removeTop es O(log n) amortizado, y decreaseKey se hace sobre
+/// el nodo que retorna insert, que sirve de handle mientras el elemento esté en el heap.
+/// Los nodos se toman de un pool propio por bloques que duplican su tamaño hasta 256 nodos, así un heap chico
+/// no reserva un bloque entero. Al unir dos heaps el pool del otro pasa a este, por lo que los handles siguen
+/// siendo válidos.
+/// @tparam Comparator Retorna true si el primer elemento debe quedar más cerca del tope que el segundo.
+template <class T, class Comparator = MinComparator<T> >
+class PairingHeap
+{
+public:
+    class Node
+    {
+        friend class PairingHeap;
+
+    private:
+        T value;
+        Node *child;
+        /// @brief Siguiente hermano. En los nodos libres del pool, siguiente nodo libre.
+        Node *sibling;
+        /// @brief Hermano anterior, o el padre si es el primer hijo.
+        Node *previous;
+
+    public:
+        Node() : child(NULL), sibling(NULL), previous(NULL) {}
+
+        T getValue() const
+        {
+            return value;
+        }
+    };
+
+private:
+    /// @brief Pool de nodos por bloques, con una lista de nodos liberados para reutilizar.
+    class NodePool
+    {
+    private:
+        static const int FIRST_CHUNK_SIZE = 8;
+        static const int MAX_CHUNK_SIZE = 256;
+
+        class Chunk
+        {
+        public:
+            Chunk *next;
+            Node *nodes;
+            explicit Chunk(int size) : next(NULL), nodes(new Node[size]) {}
+            ~Chunk()
+            {
+                delete[] nodes;
+            }
+        };
+
+        Chunk *_chunkHead;
+        Chunk *_chunkTail;
+        /// @brief Tamaño del bloque de la cabeza, o 0 si no hay bloques.
+        int _chunkSize;
+        /// @brief Cantidad de nodos ya entregados del bloque de la cabeza.
+        int _used;
+        Node *_freeHead;
+        Node *_freeTail;
+
+    public:
+        NodePool() : _chunkHead(NULL), _chunkTail(NULL), _chunkSize(0), _used(0), _freeHead(NULL), _freeTail(NULL) {}
+
+        ~NodePool()
+        {
+            while (_chunkHead != NULL)
+            {
+                Chunk *next = _chunkHead->next;
+                delete _chunkHead;
+                _chunkHead = next;
+            }
+        }
+
+        Node *allocate()
+        {
+            Node *node;
+            if (_freeHead != NULL)
+            {
+                node = _freeHead;
+                _freeHead = node->sibling;
+                if (_freeHead == NULL)
+                {
+                    _freeTail = NULL;
+                }
+            }
+            else
+            {
+                if (_used == _chunkSize)
+                {
+                    _chunkSize = _chunkSize < FIRST_CHUNK_SIZE ? FIRST_CHUNK_SIZE
+                        : _chunkSize < MAX_CHUNK_SIZE ? 2 * _chunkSize : MAX_CHUNK_SIZE;
+                    Chunk *chunk = new Chunk(_chunkSize);
+                    chunk->next = _chunkHead;
+                    _chunkHead = chunk;
+                    if (_chunkTail == NULL)
+                    {
+                        _chunkTail = chunk;
+                    }
+                    _used = 0;
+                }
+                node = &_chunkHead->nodes[_used++];
+            }
+            node->child = node->sibling = node->previous = NULL;
+            return node;
+        }
+
+        void release(Node *node)
+        {
+            node->sibling = _freeHead;
+            _freeHead = node;
+            if (_freeTail == NULL)
+            {
+                _freeTail = node;
+            }
+        }
+
+        /// @brief Toma todos los bloques y nodos libres del otro pool, que queda vacío.
+        /// Los nodos sin entregar del bloque actual del otro pool pasan a la lista de libres, para no perderlos,
+        /// por lo que es O(MAX_CHUNK_SIZE) en el peor caso.
+        void splice(NodePool &other)
+        {
+            if (other._chunkHead != NULL)
+            {
+                for (int i = other._used; i < other._chunkSize; i++)
+                {
+                    other.release(&other._chunkHead->nodes[i]);
+                }
+                // Se agregan al final para no cambiar el bloque del que se entregan nodos. Si este pool no tenía
+                // bloques, se continúa con el tamaño de bloque del otro, ya sin nodos por entregar.
+                if (_chunkTail != NULL)
+                {
+                    _chunkTail->next = other._chunkHead;
+                }
+                else
+                {
+                    _chunkHead = other._chunkHead;
+                    _chunkSize = _used = other._chunkSize;
+                }
+                _chunkTail = other._chunkTail;
+            }
+            if (other._freeHead != NULL)
+            {
+                if (_freeTail != NULL)
+                {
+                    _freeTail->sibling = other._freeHead;
+                }
+                else
+                {
+                    _freeHead = other._freeHead;
+                }
+                _freeTail = other._freeTail;
+            }
+            other._chunkHead = other._chunkTail = NULL;
+            other._freeHead = other._freeTail = NULL;
+            other._chunkSize = other._used = 0;
+        }
+    };
+
+    Node *_root;
+    int _population;
+    Comparator _comparator;
+    NodePool _pool;
+
+    /// @brief Une dos árboles, dejando como raíz a la de mejor valor. Retorna la raíz resultante.
+    Node *link(Node *first, Node *second)
+    {
+        if (_comparator(second->value, first->value))
+        {
+            Node *aux = first;
+            first = second;
+            second = aux;
+        }
+        second->previous = first;
+        second->sibling = first->child;
+        if (first->child != NULL)
+        {
+            first->child->previous = second;
+        }
+        first->child = second;
+        first->sibling = NULL;
+        first->previous = NULL;
+        return first;
+    }
+
+    /// @brief Une la lista de hermanos en un único árbol, en dos pasadas: primero de a pares
+    /// de izquierda a derecha, y luego cada par con el resultado de derecha a izquierda.
+    Node *mergePairs(Node *first)
+    {
+        if (first == NULL)
+        {
+            return NULL;
+        }
+
+        // Los pares se apilan usando sibling, por lo que quedan en orden inverso.
+        Node *pairs = NULL;
+        while (first != NULL)
+        {
+            Node *second = first->sibling;
+            Node *next = second != NULL ? second->sibling : NULL;
+            Node *pair = second != NULL ? link(first, second) : first;
+            pair->previous = NULL;
+            pair->sibling = pairs;
+            pairs = pair;
+            first = next;
+        }
+
+        Node *result = pairs;
+        pairs = pairs->sibling;
+        while (pairs != NULL)
+        {
+            Node *next = pairs->sibling;
+            result = link(pairs, result);
+            pairs = next;
+        }
+        result->sibling = NULL;
+        result->previous = NULL;
+        return result;
+    }
+
+public:
+    explicit PairingHeap(Comparator comparator = Comparator()) : _root(NULL), _population(0), _comparator(comparator) {}
+
+    ~PairingHeap() {}
+
+    /// @brief Agrega el elemento y retorna su handle, válido hasta que se quite del heap.
+    Node *insert(T element)
+    {
+        Node *node = _pool.allocate();
+        node->value = element;
+        _root = _root != NULL ? link(_root, node) : node;
+        _population++;
+        return node;
+    }
+
+    /// @brief Retorna el elemento del tope.
+    /// Precondición: el heap no es vacío.
+    T top() const
+    {
+        assert(!isEmpty());
+        return _root->value;
+    }
+
+    /// @brief Quita el elemento del tope. Si el heap es vacío, retorna false y no tiene efecto.
+    bool removeTop()
+    {
+        if (isEmpty())
+        {
+            return false;
+        }
+        Node *oldRoot = _root;
+        _root = mergePairs(oldRoot->child);
+        _pool.release(oldRoot);
+        _population--;
+        return true;
+    }
+
+    /// @brief Mejora el valor del elemento del handle dado.
+    /// Precondición: el handle está en el heap y el nuevo valor no es peor que el actual.
+    void decreaseKey(Node *handle, T element)
+    {
+        assert(!_comparator(handle->value, element));
+        handle->value = element;
+        if (handle != _root)
+        {
+            // Se corta el subárbol del nodo y se une con la raíz.
+            if (handle->previous->child == handle)
+            {
+                handle->previous->child = handle->sibling;
+            }
+            else
+            {
+                handle->previous->sibling = handle->sibling;
+            }
+            if (handle->sibling != NULL)
+            {
+                handle->sibling->previous = handle->previous;
+            }
+            handle->sibling = NULL;
+            handle->previous = NULL;
+            _root = link(_root, handle);
+        }
+    }
+
+    /// @brief Mueve todos los elementos del otro heap a éste en O(1): sólo se recorren los nodos sin entregar
+    /// de un bloque del pool del otro heap. El otro heap queda vacío, y sus handles pasan a pertenecer a éste.
+    void meld(PairingHeap &other)
+    {
+        if (&other == this)
+        {
+            return;
+        }
+        if (other._root != NULL)
+        {
+            _root = _root != NULL ? link(_root, other._root) : other._root;
+        }
+        _population += other._population;
+        _pool.splice(other._pool);
+        other._root = NULL;
+        other._population = 0;
+    }
+
+    int size() const
+    {
+        return _population;
+    }
+
+    bool isEmpty() const
+    {
+        return _population == 0;
+    }
+};
+
+#endif
@@ -0,0 +1,274 @@
+#ifndef PARALLELBFS_H
+#define PARALLELBFS_H
+
+#include <atomic> // Para marcar nodos visitados desde varios hilos.
+
+#include "csrgraph.h"
+#include "threadpool.h"
+
+/// @brief Implementa un recorrido por anchura paralelo y de dirección optimizada (Beamer).
+/// Mientras la frontera es chica, expande hacia abajo desde la frontera (top-down); cuando la
+/// frontera cubre muchas aristas, cambia a que cada nodo no visitado busque un padre en la
+/// frontera entre sus incidentes (bottom-up), que deja de buscar en cuanto lo encuentra.
+/// Las fronteras son arreglos de nodos en top-down y mapas de bits en bottom-up.
+class ParallelBFS
+{
+private:
+    /// @brief Se cambia a bottom-up cuando las aristas de la frontera superan las no exploradas / ALPHA.
+    static const int ALPHA = 14;
+    /// @brief Se vuelve a top-down cuando la frontera tiene menos de totalNodes / BETA nodos.
+    static const int BETA = 24;
+    /// @brief Cantidad de nodos que cada hilo acumula antes de reservar lugar en la próxima frontera.
+    static const int BUFFER_SIZE = 256;
+
+    const CSRGraph &_graph;
+    const CSRGraph &_reverseGraph;
+    ThreadPool _pool;
+    int _totalNodes;
+    int _words;
+    std::atomic<unsigned long long> *_visited;
+    std::atomic<unsigned long long> *_frontierBits;
+    std::atomic<unsigned long long> *_nextBits;
+    int *_frontier;
+    int *_next;
+    std::atomic<int> _nextSize;
+    std::atomic<long long> _nextEdges;
+
+    static bool testBit(const std::atomic<unsigned long long> *bits, int node)
+    {
+        return (bits[node / 64].load(std::memory_order_relaxed) >> (node % 64)) & 1ULL;
+    }
+
+    /// @brief Marca el bit del nodo. Retorna true si este hilo fue el que lo marcó.
+    static bool setBit(std::atomic<unsigned long long> *bits, int node)
+    {
+        unsigned long long mask = 1ULL << (node % 64);
+        return (bits[node / 64].fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+    }
+
+    void clearBits(std::atomic<unsigned long long> *bits)
+    {
+        _pool.parallelFor(0, _words, [bits](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                bits[i].store(0, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    void flush(int *buffer, int count, long long edges)
+    {
+        int position = _nextSize.fetch_add(count, std::memory_order_relaxed);
+        for (int i = 0; i < count; i++)
+        {
+            _next[position + i] = buffer[i];
+        }
+        _nextEdges.fetch_add(edges, std::memory_order_relaxed);
+    }
+
+    void topDownStep(int frontierSize, int depth, int *parents, int *depths)
+    {
+        _pool.parallelFor(0, frontierSize, [&](int begin, int end, int)
+        {
+            int buffer[BUFFER_SIZE];
+            int count = 0;
+            long long edges = 0;
+            for (int i = begin; i < end; i++)
+            {
+                int node = _frontier[i];
+                for (int e = _graph.edgesBegin(node); e < _graph.edgesEnd(node); e++)
+                {
+                    int adjacentNode = _graph.target(e);
+                    if (!testBit(_visited, adjacentNode) && setBit(_visited, adjacentNode))
+                    {
+                        parents[adjacentNode] = node;
+                        depths[adjacentNode] = depth;
+                        edges += _graph.outDegree(adjacentNode);
+                        buffer[count++] = adjacentNode;
+                        if (count == BUFFER_SIZE)
+                        {
+                            flush(buffer, count, edges);
+                            count = 0;
+                            edges = 0;
+                        }
+                    }
+                }
+            }
+            flush(buffer, count, edges);
+        }, 64);
+    }
+
+    void bottomUpStep(int depth, int *parents, int *depths)
+    {
+        // Los rangos son múltiplos de 64 nodos, para que cada palabra de bits sea de un único hilo.
+        _pool.parallelFor(0, _words, [&](int begin, int end, int)
+        {
+            int count = 0;
+            long long edges = 0;
+            for (int word = begin; word < end; word++)
+            {
+                int first = word * 64 > 1 ? word * 64 : 1;
+                int last = word * 64 + 63 < _totalNodes ? word * 64 + 63 : _totalNodes;
+                for (int node = first; node <= last; node++)
+                {
+                    if (testBit(_visited, node))
+                    {
+                        continue;
+                    }
+                    for (int e = _reverseGraph.edgesBegin(node); e < _reverseGraph.edgesEnd(node); e++)
+                    {
+                        int parent = _reverseGraph.target(e);
+                        if (testBit(_frontierBits, parent))
+                        {
+                            parents[node] = parent;
+                            depths[node] = depth;
+                            setBit(_visited, node);
+                            setBit(_nextBits, node);
+                            count++;
+                            edges += _graph.outDegree(node);
+                            break;
+                        }
+                    }
+                }
+            }
+            _nextSize.fetch_add(count, std::memory_order_relaxed);
+            _nextEdges.fetch_add(edges, std::memory_order_relaxed);
+        }, 16);
+    }
+
+    void queueToBits(int frontierSize)
+    {
+        clearBits(_frontierBits);
+        _pool.parallelFor(0, frontierSize, [&](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                setBit(_frontierBits, _frontier[i]);
+            }
+        });
+    }
+
+    int bitsToQueue()
+    {
+        _nextSize.store(0, std::memory_order_relaxed);
+        _pool.parallelFor(0, _words, [&](int begin, int end, int)
+        {
+            int buffer[BUFFER_SIZE];
+            int count = 0;
+            for (int word = begin; word < end; word++)
+            {
+                unsigned long long bits = _frontierBits[word].load(std::memory_order_relaxed);
+                while (bits != 0)
+                {
+                    buffer[count++] = word * 64 + __builtin_ctzll(bits);
+                    bits &= bits - 1;
+                    if (count == BUFFER_SIZE)
+                    {
+                        flush(buffer, count, 0);
+                        count = 0;
+                    }
+                }
+            }
+            flush(buffer, count, 0);
+        });
+        int *aux = _frontier;
+        _frontier = _next;
+        _next = aux;
+        return _nextSize.load(std::memory_order_relaxed);
+    }
+
+public:
+    /// @brief Prepara el recorrido sobre el grafo dado.
+    /// @param graph El grafo.
+    /// @param reverseGraph El grafo con las aristas invertidas. Si el grafo no es dirigido, es el mismo grafo.
+    /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+    explicit ParallelBFS(const CSRGraph &graph, const CSRGraph &reverseGraph, int threads)
+        : _graph(graph), _reverseGraph(reverseGraph), _pool(threads)
+    {
+        _totalNodes = graph.totalNodes();
+        _words = _totalNodes / 64 + 1;
+        _visited = new std::atomic<unsigned long long>[_words];
+        _frontierBits = new std::atomic<unsigned long long>[_words];
+        _nextBits = new std::atomic<unsigned long long>[_words];
+        _frontier = new int[_totalNodes + 1];
+        _next = new int[_totalNodes + 1];
+    }
+
+    ~ParallelBFS()
+    {
+        delete[] _visited;
+        delete[] _frontierBits;
+        delete[] _nextBits;
+        delete[] _frontier;
+        delete[] _next;
+    }
+
+    /// @brief Recorre el grafo por anchura desde el nodo dado.
+    /// @param parents Arreglo de totalNodes + 1 posiciones donde se guarda el padre de cada nodo en el árbol
+    /// del recorrido. El del origen es él mismo y el de los nodos no alcanzados es 0.
+    /// @param depths Arreglo de totalNodes + 1 posiciones donde se guarda la distancia en aristas desde el origen,
+    /// o -1 si el nodo no fue alcanzado.
+    /// @return La cantidad de niveles del recorrido.
+    int search(int nodeFrom, int *parents, int *depths)
+    {
+        clearBits(_visited);
+        _pool.parallelFor(0, _totalNodes + 1, [&](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                parents[i] = 0;
+                depths[i] = -1;
+            }
+        });
+
+        parents[nodeFrom] = nodeFrom;
+        depths[nodeFrom] = 0;
+        setBit(_visited, nodeFrom);
+        _frontier[0] = nodeFrom;
+        int frontierSize = 1;
+        long long frontierEdges = _graph.outDegree(nodeFrom);
+        long long unexploredEdges = _graph.totalEdges() - frontierEdges;
+        bool isTopDown = true;
+        int depth = 0;
+
+        while (frontierSize > 0)
+        {
+            depth++;
+            if (isTopDown && frontierEdges > unexploredEdges / ALPHA)
+            {
+                queueToBits(frontierSize);
+                isTopDown = false;
+            }
+            else if (!isTopDown && frontierSize < _totalNodes / BETA)
+            {
+                frontierSize = bitsToQueue();
+                isTopDown = true;
+            }
+
+            _nextSize.store(0, std::memory_order_relaxed);
+            _nextEdges.store(0, std::memory_order_relaxed);
+            if (isTopDown)
+            {
+                topDownStep(frontierSize, depth, parents, depths);
+                int *aux = _frontier;
+                _frontier = _next;
+                _next = aux;
+            }
+            else
+            {
+                clearBits(_nextBits);
+                bottomUpStep(depth, parents, depths);
+                std::atomic<unsigned long long> *aux = _frontierBits;
+                _frontierBits = _nextBits;
+                _nextBits = aux;
+            }
+            frontierSize = _nextSize.load(std::memory_order_relaxed);
+            frontierEdges = _nextEdges.load(std::memory_order_relaxed);
+            unexploredEdges -= frontierEdges;
+        }
+        return depth;
+    }
+};
+
+#endif
@@ -0,0 +1,396 @@
+#ifndef PERSISTENTAVL_H
+#define PERSISTENTAVL_H
+
+#include <atomic> // Para los contadores de referencias de los nodos compartidos entre versiones.
+#include <mutex>
+#include <thread> // Para ceder el procesador mientras el escritor espera a los lectores.
+
+#include "list.h"
+
+/// @brief Implementa un árbol AVL persistente (path-copying) de tipo T.
+/// Cada insert o remove copia únicamente los O(log n) nodos del camino que modifica,
+/// compartiendo el resto con la versión anterior, y publica la nueva raíz.
+/// Los lectores obtienen un Snapshot inmutable que pueden recorrer sin bloquear al escritor
+/// ni ser bloqueados por él. Los nodos se liberan por conteo de referencias cuando
+/// ninguna versión los utiliza.
+/// La raíz se publica en un puntero atómico. Para que un lector pueda leerla y tomar su referencia
+/// sin que el escritor la libere en el medio, se usa reclamación por épocas: el lector se anota en
+/// el contador de la época actual mientras lee la raíz, y el escritor, antes de liberar la raíz
+/// anterior, avanza la época y espera a que se vacíen los contadores de las épocas pasadas.
+/// Los lectores nunca esperan ni toman un lock; sólo el escritor espera, y por lecturas de O(1).
+/// @note Las escrituras se serializan entre sí.
+template <typename T>
+class PersistentAVL
+{
+private:
+    class PNode
+    {
+    public:
+        int height;
+        T data;
+        const PNode *leftNode;
+        const PNode *rightNode;
+        /// @brief Cantidad de elementos del subárbol, para conocer el tamaño de cada versión por su raíz.
+        int size;
+        mutable std::atomic<int> references;
+        PNode(T data, const PNode *leftNode, const PNode *rightNode, int height, int size)
+            : height(height), data(data), leftNode(leftNode), rightNode(rightNode), size(size), references(1) {}
+        ~PNode() {}
+    };
+
+    std::atomic<const PNode *> rootNode;
+    /// @brief Época actual y cantidad de lectores anotados en las épocas pares e impares.
+    std::atomic<unsigned> _epoch;
+    std::atomic<int> _readers[2];
+    std::mutex _writerMutex;
+
+    static void acquire(const PNode *treeNode)
+    {
+        if (treeNode != NULL)
+        {
+            treeNode->references.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    /// @brief Libera una referencia al nodo. Si era la última, libera también
+    /// las referencias que el nodo tenía sobre sus hijos.
+    static void release(const PNode *treeNode)
+    {
+        while (treeNode != NULL && treeNode->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            const PNode *leftNode = treeNode->leftNode;
+            const PNode *rightNode = treeNode->rightNode;
+            delete treeNode;
+            release(leftNode);
+            // Se itera sobre el hijo derecho para no crecer la recursión en ambas ramas.
+            treeNode = rightNode;
+        }
+    };
+
+    static int height(const PNode *treeNode)
+    {
+        return treeNode != NULL ? treeNode->height : 0;
+    };
+
+    static int size(const PNode *treeNode)
+    {
+        return treeNode != NULL ? treeNode->size : 0;
+    };
+
+    /// @brief Crea un nodo nuevo que comparte los subárboles dados.
+    /// Retorna una referencia propia del llamador.
+    static const PNode *makeNode(T data, const PNode *leftNode, const PNode *rightNode)
+    {
+        acquire(leftNode);
+        acquire(rightNode);
+        return new PNode(data, leftNode, rightNode, 1 + max(height(leftNode), height(rightNode)), 1 + size(leftNode) + size(rightNode));
+    };
+
+    /// @brief Construye un nodo balanceado con el dato y los subárboles dados, aplicando
+    /// las rotaciones del AVL sobre copias. Los subárboles son prestados, el resultado es propio.
+    static const PNode *balance(T data, const PNode *leftNode, const PNode *rightNode)
+    {
+        int balance = height(rightNode) - height(leftNode);
+
+        if (balance < -1)
+        { // I
+            if (height(leftNode->leftNode) >= height(leftNode->rightNode))
+            { // II
+                const PNode *newRight = makeNode(data, leftNode->rightNode, rightNode);
+                const PNode *result = makeNode(leftNode->data, leftNode->leftNode, newRight);
+                release(newRight);
+                return result;
+            }
+            else
+            { // ID
+                const PNode *middle = leftNode->rightNode;
+                const PNode *newLeft = makeNode(leftNode->data, leftNode->leftNode, middle->leftNode);
+                const PNode *newRight = makeNode(data, middle->rightNode, rightNode);
+                const PNode *result = makeNode(middle->data, newLeft, newRight);
+                release(newLeft);
+                release(newRight);
+                return result;
+            }
+        }
+        else if (balance > 1)
+        { // D
+            if (height(rightNode->rightNode) >= height(rightNode->leftNode))
+            { // DD
+                const PNode *newLeft = makeNode(data, leftNode, rightNode->leftNode);
+                const PNode *result = makeNode(rightNode->data, newLeft, rightNode->rightNode);
+                release(newLeft);
+                return result;
+            }
+            else
+            { // DI
+                const PNode *middle = rightNode->leftNode;
+                const PNode *newLeft = makeNode(data, leftNode, middle->leftNode);
+                const PNode *newRight = makeNode(rightNode->data, middle->rightNode, rightNode->rightNode);
+                const PNode *result = makeNode(middle->data, newLeft, newRight);
+                release(newLeft);
+                release(newRight);
+                return result;
+            }
+        }
+
+        return makeNode(data, leftNode, rightNode);
+    };
+
+    static const PNode *insertRec(const PNode *treeNode, T element)
+    {
+        if (treeNode == NULL)
+        {
+            return makeNode(element, NULL, NULL);
+        }
+
+        const PNode *result;
+        if (element <= treeNode->data)
+        {
+            const PNode *newLeft = insertRec(treeNode->leftNode, element);
+            result = balance(treeNode->data, newLeft, treeNode->rightNode);
+            release(newLeft);
+        }
+        else
+        {
+            const PNode *newRight = insertRec(treeNode->rightNode, element);
+            result = balance(treeNode->data, treeNode->leftNode, newRight);
+            release(newRight);
+        }
+        return result;
+    };
+
+    /// @brief Quita el menor elemento del subárbol.
+    static const PNode *removeMinRec(const PNode *treeNode)
+    {
+        if (treeNode->leftNode == NULL)
+        {
+            acquire(treeNode->rightNode);
+            return treeNode->rightNode;
+        }
+        const PNode *newLeft = removeMinRec(treeNode->leftNode);
+        const PNode *result = balance(treeNode->data, newLeft, treeNode->rightNode);
+        release(newLeft);
+        return result;
+    };
+
+    /// @brief Precondición: el elemento pertenece al subárbol.
+    static const PNode *removeRec(const PNode *treeNode, T element)
+    {
+        const PNode *result;
+        if (element < treeNode->data)
+        {
+            const PNode *newLeft = removeRec(treeNode->leftNode, element);
+            result = balance(treeNode->data, newLeft, treeNode->rightNode);
+            release(newLeft);
+        }
+        else if (treeNode->data < element)
+        {
+            const PNode *newRight = removeRec(treeNode->rightNode, element);
+            result = balance(treeNode->data, treeNode->leftNode, newRight);
+            release(newRight);
+        }
+        else if (treeNode->leftNode == NULL || treeNode->rightNode == NULL)
+        {
+            result = treeNode->leftNode != NULL ? treeNode->leftNode : treeNode->rightNode;
+            acquire(result);
+        }
+        else
+        {
+            // El sucesor sigue vivo en la versión anterior, así que su dato se copia directamente de él.
+            const PNode *successor = treeNode->rightNode;
+            while (successor->leftNode != NULL)
+            {
+                successor = successor->leftNode;
+            }
+            const PNode *newRight = removeMinRec(treeNode->rightNode);
+            result = balance(successor->data, treeNode->leftNode, newRight);
+            release(newRight);
+        }
+        return result;
+    };
+
+    static bool containsRec(const PNode *treeNode, T element)
+    {
+        while (treeNode != NULL)
+        {
+            if (element < treeNode->data)
+            {
+                treeNode = treeNode->leftNode;
+            }
+            else if (treeNode->data < element)
+            {
+                treeNode = treeNode->rightNode;
+            }
+            else
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    static void toListRec(List<T> *list, const PNode *treeNode)
+    {
+        if (treeNode != NULL)
+        {
+            toListRec(list, treeNode->leftNode);
+            list->add(treeNode->data);
+            toListRec(list, treeNode->rightNode);
+        }
+    };
+
+    /// @brief Anota al lector en la época actual. Retorna el contador donde se anotó.
+    std::atomic<int> &enterRead()
+    {
+        std::atomic<int> &readers = _readers[_epoch.load() & 1];
+        readers.fetch_add(1);
+        return readers;
+    };
+
+    /// @brief Publica la nueva raíz y libera la referencia a la versión anterior.
+    /// Un lector que leyó la raíz anterior antes del intercambio está anotado en alguno de los dos
+    /// contadores. Se avanza la época dos veces y, tras cada avance, se espera a que se vacíe el
+    /// contador que se dejó de usar: los lectores nuevos se anotan en el otro, así que la espera
+    /// termina aunque lleguen lectores todo el tiempo.
+    void publish(const PNode *newRoot)
+    {
+        const PNode *oldRoot = rootNode.exchange(newRoot);
+        for (int step = 0; step < 2; step++)
+        {
+            unsigned epoch = _epoch.fetch_add(1);
+            while (_readers[epoch & 1].load() != 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+        release(oldRoot);
+    };
+
+public:
+    /// @brief Versión inmutable del árbol. Mantiene vivos sus nodos mientras exista,
+    /// por lo que puede recorrerse sin sincronización aunque el árbol siga cambiando.
+    class Snapshot
+    {
+    private:
+        const PNode *_root;
+
+    public:
+        /// @brief Toma posesión de una referencia a la raíz.
+        explicit Snapshot(const PNode *root) : _root(root) {}
+
+        Snapshot(const Snapshot &other) : _root(other._root)
+        {
+            acquire(_root);
+        }
+
+        Snapshot &operator=(const Snapshot &other)
+        {
+            acquire(other._root);
+            release(_root);
+            _root = other._root;
+            return *this;
+        }
+
+        ~Snapshot()
+        {
+            release(_root);
+        }
+
+        bool contains(T element) const
+        {
+            return containsRec(_root, element);
+        }
+
+        int size() const
+        {
+            return PersistentAVL::size(_root);
+        }
+
+        bool isEmpty() const
+        {
+            return _root == NULL;
+        }
+
+        /// @brief Aplica la función a cada elemento de la versión, en orden.
+        template <class F>
+        void forEachInOrder(F f) const
+        {
+            const PNode *stack[64];
+            int top = 0;
+            const PNode *cursor = _root;
+            while (cursor != NULL || top > 0)
+            {
+                while (cursor != NULL)
+                {
+                    stack[top++] = cursor;
+                    cursor = cursor->leftNode;
+                }
+                cursor = stack[--top];
+                f(cursor->data);
+                cursor = cursor->rightNode;
+            }
+        }
+
+        /// @brief Retorna los elementos de la versión en una lista en orden.
+        /// Si la versión es vacía, retorna una lista vacía.
+        List<T> *toList() const
+        {
+            List<T> *list = new List<T>();
+            toListRec(list, _root);
+            return list;
+        }
+    };
+
+    PersistentAVL() : rootNode(NULL), _epoch(0)
+    {
+        _readers[0].store(0);
+        _readers[1].store(0);
+    }
+
+    /// @brief Precondición: no hay lecturas en curso. Los snapshots tomados siguen siendo válidos.
+    ~PersistentAVL()
+    {
+        release(rootNode.load());
+    }
+
+    /// @brief Retorna la versión actual del árbol. No toma locks ni espera a otros lectores
+    /// ni a una escritura en curso.
+    Snapshot snapshot()
+    {
+        std::atomic<int> &readers = enterRead();
+        const PNode *root = rootNode.load();
+        acquire(root);
+        readers.fetch_sub(1);
+        return Snapshot(root);
+    };
+
+    void insert(T element)
+    {
+        std::lock_guard<std::mutex> writerLock(_writerMutex);
+        // Sólo el escritor cambia la raíz, así que la puede recorrer sin anotarse como lector.
+        publish(insertRec(rootNode.load(), element));
+    };
+
+    /// @brief Quita una ocurrencia del elemento del árbol.
+    /// Si el elemento no pertenece al árbol, el método no tiene efecto.
+    void remove(T element)
+    {
+        std::lock_guard<std::mutex> writerLock(_writerMutex);
+        const PNode *root = rootNode.load();
+        if (containsRec(root, element))
+        {
+            publish(removeRec(root, element));
+        }
+    };
+
+    /// @brief Busca el elemento en la versión actual.
+    /// La búsqueda se hace sobre un snapshot y no mientras el lector está anotado, para que el escritor
+    /// sólo espere lecturas de O(1).
+    bool contains(T element)
+    {
+        return snapshot().contains(element);
+    };
+
+};
+
+#endif
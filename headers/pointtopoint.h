@@ -0,0 +1,264 @@
+#ifndef POINTTOPOINT_H
+#define POINTTOPOINT_H
+
+#include "csrgraph.h"
+#include "indexedpqueue.h"
+#include "stack.h"
+
+/// @brief Implementa búsquedas de camino más corto entre un par de nodos sobre un grafo CSR:
+/// Dijkstra bidireccional y A* con una heurística dada por el usuario.
+/// Las estructuras se reservan una única vez y se reutilizan entre consultas: cada nodo guarda
+/// el número de la última consulta que lo alcanzó, por lo que no hay que reiniciar los arreglos.
+/// @note Precondición: los pesos de arista no son negativos.
+class PointToPointSearch
+{
+private:
+    /// @brief Estado de la búsqueda en uno de los sentidos.
+    class Direction
+    {
+    public:
+        const CSRGraph *graph;
+        IndexedPQueue<long long> *queue;
+        /// @brief Última consulta en la que se alcanzó o se asentó cada nodo.
+        int *reached;
+        int *settled;
+        long long *distance;
+        /// @brief Nodo anterior en el camino desde el origen de este sentido.
+        int *previous;
+
+        Direction() : graph(NULL), queue(NULL), reached(NULL), settled(NULL), distance(NULL), previous(NULL) {}
+
+        void init(const CSRGraph &g)
+        {
+            int totalNodes = g.totalNodes();
+            graph = &g;
+            queue = new IndexedPQueue<long long>(totalNodes);
+            reached = new int[totalNodes + 1];
+            settled = new int[totalNodes + 1];
+            distance = new long long[totalNodes + 1];
+            previous = new int[totalNodes + 1];
+            for (int i = 0; i <= totalNodes; i++)
+            {
+                reached[i] = 0;
+                settled[i] = 0;
+            }
+        }
+
+        ~Direction()
+        {
+            delete queue;
+            delete[] reached;
+            delete[] settled;
+            delete[] distance;
+            delete[] previous;
+        }
+    };
+
+    /// @brief Distancia del mejor camino mientras no se encontró ninguno.
+    static const long long NO_PATH = 1LL << 62;
+
+    int _totalNodes;
+    int _query;
+    int _settledNodes;
+    /// @brief Sentido hacia adelante desde el origen y hacia atrás desde el destino, sobre el grafo inverso.
+    Direction _forward;
+    Direction _backward;
+
+    bool isReached(const Direction &direction, int node) const
+    {
+        return direction.reached[node] == _query;
+    }
+
+    void start(Direction &direction, int node, long long priority)
+    {
+        direction.queue->clear();
+        direction.reached[node] = _query;
+        direction.distance[node] = 0;
+        direction.previous[node] = 0;
+        direction.queue->enqueue(node, priority);
+    }
+
+    void nextQuery()
+    {
+        if (++_query == INT32_MAX)
+        {
+            // Al dar la vuelta el contador se reinician las marcas para no confundir consultas viejas.
+            for (int i = 0; i <= _totalNodes; i++)
+            {
+                _forward.reached[i] = _forward.settled[i] = 0;
+                _backward.reached[i] = _backward.settled[i] = 0;
+            }
+            _query = 1;
+        }
+        _settledNodes = 0;
+    }
+
+    /// @brief Asienta el primer nodo de la cola del sentido dado y relaja sus aristas,
+    /// actualizando el mejor camino encontrado si alguna alcanza un nodo del otro sentido.
+    void settleNext(Direction &direction, const Direction &other, long long &best, int &meetingNode)
+    {
+        int node = direction.queue->front();
+        direction.queue->dequeue();
+        direction.settled[node] = _query;
+        _settledNodes++;
+        const CSRGraph &graph = *direction.graph;
+        for (int e = graph.edgesBegin(node); e < graph.edgesEnd(node); e++)
+        {
+            int adjacentNode = graph.target(e);
+            long long newDistance = direction.distance[node] + graph.weight(e);
+            if (direction.settled[adjacentNode] == _query)
+            {
+                continue;
+            }
+            if (!isReached(direction, adjacentNode) || newDistance < direction.distance[adjacentNode])
+            {
+                direction.reached[adjacentNode] = _query;
+                direction.distance[adjacentNode] = newDistance;
+                direction.previous[adjacentNode] = node;
+                direction.queue->enqueueOrDecreaseKey(adjacentNode, newDistance);
+                if (isReached(other, adjacentNode) && newDistance + other.distance[adjacentNode] < best)
+                {
+                    best = newDistance + other.distance[adjacentNode];
+                    meetingNode = adjacentNode;
+                }
+            }
+        }
+    }
+
+    /// @brief Arma el camino pasando por el nodo de encuentro: desde el destino hasta el encuentro
+    /// con los anteriores del sentido inverso, y desde el encuentro hasta el origen con los del directo.
+    Stack<int> *buildPath(int meetingNode, bool useBackward)
+    {
+        Stack<int> *path = new Stack<int>();
+        if (useBackward)
+        {
+            int length = 0;
+            for (int node = meetingNode; node != 0; node = _backward.previous[node])
+            {
+                length++;
+            }
+            int *tail = new int[length];
+            int index = 0;
+            for (int node = meetingNode; node != 0; node = _backward.previous[node])
+            {
+                tail[index++] = node;
+            }
+            for (int i = length - 1; i > 0; i--)
+            {
+                path->push(tail[i]);
+            }
+            delete[] tail;
+        }
+        for (int node = meetingNode; node != 0; node = _forward.previous[node])
+        {
+            path->push(node);
+        }
+        return path;
+    }
+
+public:
+    /// @brief Prepara las búsquedas sobre el grafo dado.
+    /// @param graph El grafo.
+    /// @param reverseGraph El grafo con las aristas invertidas. Si el grafo no es dirigido, es el mismo grafo.
+    explicit PointToPointSearch(const CSRGraph &graph, const CSRGraph &reverseGraph)
+    {
+        _totalNodes = graph.totalNodes();
+        _query = 0;
+        _settledNodes = 0;
+        _forward.init(graph);
+        _backward.init(reverseGraph);
+    }
+
+    /// @brief Retorna la cantidad de nodos asentados en la última consulta.
+    int settledNodes() const
+    {
+        return _settledNodes;
+    }
+
+    /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro, comenzando desde el origen,
+    /// o un stack vacío si no hay camino.
+    /// Busca a la vez desde el origen y, sobre el grafo inverso, desde el destino, expandiendo siempre el sentido
+    /// con la menor distancia pendiente. Termina cuando la suma de ambas distancias pendientes no puede mejorar
+    /// el mejor camino encontrado, por lo que cada sentido explora aproximadamente la mitad del radio.
+    Stack<int> *bidirectionalDijkstra(int from, int to)
+    {
+        nextQuery();
+        long long best = NO_PATH;
+        int meetingNode = 0;
+        start(_forward, from, 0);
+        start(_backward, to, 0);
+        if (from == to)
+        {
+            best = 0;
+            meetingNode = from;
+        }
+        while (!_forward.queue->isEmpty() && !_backward.queue->isEmpty())
+        {
+            long long forwardMin = _forward.queue->frontPriority();
+            long long backwardMin = _backward.queue->frontPriority();
+            if (forwardMin + backwardMin >= best)
+            {
+                break;
+            }
+            if (forwardMin <= backwardMin)
+            {
+                settleNext(_forward, _backward, best, meetingNode);
+            }
+            else
+            {
+                settleNext(_backward, _forward, best, meetingNode);
+            }
+        }
+        if (best == NO_PATH)
+        {
+            return new Stack<int>();
+        }
+        return buildPath(meetingNode, true);
+    }
+
+    /// @brief Retorna un stack con el camino más corto desde un nodo hasta otro con A*, comenzando desde el origen,
+    /// o un stack vacío si no hay camino.
+    /// Los nodos se expanden por distancia más heurística, por lo que la búsqueda avanza hacia el destino.
+    /// @param heuristic Función heuristic(node) que retorna una cota inferior de la distancia desde el nodo
+    /// hasta el destino, por ejemplo por coordenadas o por landmarks. Si la cota no es consistente, un nodo
+    /// puede volver a expandirse, pero el camino sigue siendo mínimo. Con heurística nula equivale a Dijkstra.
+    template <class H>
+    Stack<int> *aStar(int from, int to, H heuristic)
+    {
+        nextQuery();
+        Direction &search = _forward;
+        start(search, from, heuristic(from));
+        bool found = false;
+        while (!search.queue->isEmpty())
+        {
+            int node = search.queue->front();
+            search.queue->dequeue();
+            _settledNodes++;
+            if (node == to)
+            {
+                found = true;
+                break;
+            }
+            const CSRGraph &graph = *search.graph;
+            for (int e = graph.edgesBegin(node); e < graph.edgesEnd(node); e++)
+            {
+                int adjacentNode = graph.target(e);
+                long long newDistance = search.distance[node] + graph.weight(e);
+                if (!isReached(search, adjacentNode) || newDistance < search.distance[adjacentNode])
+                {
+                    search.reached[adjacentNode] = _query;
+                    search.distance[adjacentNode] = newDistance;
+                    search.previous[adjacentNode] = node;
+                    search.queue->enqueueOrDecreaseKey(adjacentNode, newDistance + heuristic(adjacentNode));
+                }
+            }
+        }
+        if (!found)
+        {
+            return new Stack<int>();
+        }
+        return buildPath(to, false);
+    }
+};
+
+#endif
@@ -45,7 +45,7 @@ class PQueue
         };
         int _population;
         int _size;
-        Heap<Pair> * _queueHeap;
+        Heap<Pair, MinComparator<Pair> > * _queueHeap;
 
     public:
 
@@ -55,7 +55,7 @@ class PQueue
         {
             _population = 0;
             _size = size;
-            _queueHeap = new Heap<Pair>(_size, MIN);
+            _queueHeap = new Heap<Pair, MinComparator<Pair> >(_size);
         }
 
         ~PQueue()
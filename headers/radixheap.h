@@ -0,0 +1,207 @@
+#ifndef RADIXHEAP_H
+#define RADIXHEAP_H
+
+/// @brief Implementa un radix heap indexado sobre identificadores enteros de 1 a maxId,
+/// con prioridades enteras no negativas. El valor de prioridad menor es el más prioritario.
+/// Es monótono: ninguna prioridad puede ser menor que la del último identificador quitado,
+/// como ocurre en Dijkstra. A cambio, cada operación cuesta O(1) amortizado más O(log C) por
+/// identificador a lo largo de su vida, sin comparar prioridades en un heap.
+/// Tiene la misma interfaz que IndexedPQueue.
+/// @note Como en el resto de las estructuras, no se utiliza el índice 0.
+class RadixHeap
+{
+private:
+    /// @brief El balde 0 guarda las prioridades iguales a la última quitada, y el balde b > 0 las que
+    /// difieren de ella por primera vez en el bit b-1, contando desde el más significativo.
+    static const int BUCKETS = 33;
+
+    int _population;
+    int _maxId;
+    unsigned int _last;
+    int _head[BUCKETS];
+    /// @brief Listas doblemente enlazadas de identificadores por balde, sobre arreglos.
+    int *_next;
+    int *_previous;
+    /// @brief Balde de cada identificador, o -1 si no está en la cola.
+    int *_bucket;
+    unsigned int *_key;
+
+    int bucketIndex(unsigned int key) const
+    {
+        return key == _last ? 0 : 32 - __builtin_clz(key ^ _last);
+    }
+
+    void link(int id, int bucket)
+    {
+        _bucket[id] = bucket;
+        _previous[id] = 0;
+        _next[id] = _head[bucket];
+        if (_head[bucket] != 0)
+        {
+            _previous[_head[bucket]] = id;
+        }
+        _head[bucket] = id;
+    }
+
+    void unlink(int id)
+    {
+        int bucket = _bucket[id];
+        if (_previous[id] != 0)
+        {
+            _next[_previous[id]] = _next[id];
+        }
+        else
+        {
+            _head[bucket] = _next[id];
+        }
+        if (_next[id] != 0)
+        {
+            _previous[_next[id]] = _previous[id];
+        }
+        _bucket[id] = -1;
+    }
+
+    /// @brief Si el balde 0 está vacío, toma la menor prioridad del primer balde no vacío como
+    /// la última, y redistribuye ese balde: todos sus identificadores pasan a baldes menores.
+    void refill()
+    {
+        if (_head[0] != 0 || _population == 0)
+        {
+            return;
+        }
+        int bucket = 1;
+        while (_head[bucket] == 0)
+        {
+            bucket++;
+        }
+        unsigned int minKey = _key[_head[bucket]];
+        for (int id = _head[bucket]; id != 0; id = _next[id])
+        {
+            if (_key[id] < minKey)
+            {
+                minKey = _key[id];
+            }
+        }
+        _last = minKey;
+        int id = _head[bucket];
+        _head[bucket] = 0;
+        while (id != 0)
+        {
+            int nextId = _next[id];
+            link(id, bucketIndex(_key[id]));
+            id = nextId;
+        }
+    }
+
+public:
+    /// @brief Crea una cola vacía para identificadores de 1 a maxId.
+    explicit RadixHeap(int maxId)
+    {
+        _population = 0;
+        _maxId = maxId;
+        _last = 0;
+        _next = new int[_maxId + 1];
+        _previous = new int[_maxId + 1];
+        _bucket = new int[_maxId + 1];
+        _key = new unsigned int[_maxId + 1];
+        for (int i = 0; i < BUCKETS; i++)
+        {
+            _head[i] = 0;
+        }
+        for (int i = 0; i <= _maxId; i++)
+        {
+            _bucket[i] = -1;
+        }
+    }
+
+    ~RadixHeap()
+    {
+        delete[] _next;
+        delete[] _previous;
+        delete[] _bucket;
+        delete[] _key;
+    }
+
+    /// @brief Agrega el identificador a la cola con la prioridad dada.
+    /// Precondición: el identificador no está en la cola y la prioridad no es menor que la última quitada.
+    void enqueue(int id, int priority)
+    {
+        assert(id > 0 && id <= _maxId && !contains(id) && priority >= 0 && (unsigned int)priority >= _last);
+        _key[id] = (unsigned int)priority;
+        link(id, bucketIndex(_key[id]));
+        _population++;
+    }
+
+    /// @brief Disminuye la prioridad del identificador.
+    /// Precondición: el identificador está en la cola y la nueva prioridad no es mayor a la actual
+    /// ni menor que la última quitada.
+    void decreaseKey(int id, int priority)
+    {
+        assert(contains(id) && (unsigned int)priority <= _key[id] && (unsigned int)priority >= _last);
+        unlink(id);
+        _key[id] = (unsigned int)priority;
+        link(id, bucketIndex(_key[id]));
+    }
+
+    /// @brief Agrega el identificador o, si ya está en la cola, disminuye su prioridad.
+    void enqueueOrDecreaseKey(int id, int priority)
+    {
+        if (contains(id))
+        {
+            decreaseKey(id, priority);
+        }
+        else
+        {
+            enqueue(id, priority);
+        }
+    }
+
+    /// @brief Retorna true si el identificador está en la cola.
+    bool contains(int id) const
+    {
+        return _bucket[id] != -1;
+    }
+
+    /// @brief Quita de la cola al primero.
+    /// Si la cola está vacía, no tiene efecto.
+    void dequeue()
+    {
+        if (!isEmpty())
+        {
+            refill();
+            unlink(_head[0]);
+            _population--;
+        }
+    }
+
+    /// @brief Retorna el identificador más prioritario.
+    /// Precondición: La cola no está vacía.
+    int front()
+    {
+        assert(!isEmpty());
+        refill();
+        return _head[0];
+    }
+
+    /// @brief Retorna la prioridad del identificador más prioritario.
+    /// Precondición: La cola no está vacía.
+    int frontPriority()
+    {
+        assert(!isEmpty());
+        refill();
+        return (int)_last;
+    }
+
+    /// @brief Retorna el tamaño actual de la cola.
+    int size() const
+    {
+        return _population;
+    }
+
+    bool isEmpty() const
+    {
+        return _population == 0;
+    }
+};
+
+#endif
@@ -0,0 +1,487 @@
+#ifndef REORDER_H
+#define REORDER_H
+
+#include "csrgraph.h"
+
+/// @brief Criterio para renumerar los nodos de un grafo.
+/// REVERSE_CUTHILL_MCKEE recorre el grafo por anchura y numera juntos a los nodos cercanos, lo que reduce el ancho
+/// de banda de la matriz de adyacencia. DEGREE_DESCENDING numera primero a los nodos de mayor grado, que son los
+/// más visitados. WINDOW_LOCALITY (como Gorder) numera a continuación el nodo más relacionado con los últimos
+/// numerados: vecinos directos o nodos con vecinos de entrada en común.
+enum ReorderingType {REVERSE_CUTHILL_MCKEE, DEGREE_DESCENDING, WINDOW_LOCALITY};
+
+/// @brief Permutación de los nodos de un grafo que mejora la localidad de sus recorridos: los nodos que
+/// se visitan juntos quedan cerca en los arreglos indexados por nodo, como los de visitados y distancias.
+/// Permite reconstruir el grafo con la nueva numeración y traducir los resultados a la numeración original.
+class Reordering
+{
+private:
+    /// @brief Cantidad de nodos recientes con los que se compara cada candidato en WINDOW_LOCALITY.
+    static const int DEFAULT_WINDOW = 5;
+    /// @brief Los nodos con más vecinos de salida no relacionan a sus vecinos entre sí en WINDOW_LOCALITY,
+    /// porque actualizarlos cuesta el cuadrado de su grado.
+    static const int HUB_DEGREE = 256;
+
+    int _totalNodes;
+    /// @brief Número nuevo de cada nodo original, y número original de cada nodo nuevo.
+    int *_newId;
+    int *_originalId;
+
+    /// @brief Cola de prioridad de nodos con claves enteras que sólo cambian de a uno, como en Gorder: cada clave
+    /// es una lista doblemente enlazada, por lo que incrementar, decrementar y quitar cuestan O(1).
+    class UnitHeap
+    {
+    public:
+        int *key;
+        int *previous;
+        int *next;
+        /// @brief Primer nodo con cada clave, o 0 si no hay.
+        int *head;
+        int headCapacity;
+        int maxKey;
+        bool *contained;
+
+        /// @brief Crea la cola con los nodos en el orden dado, todos con clave 0.
+        /// El primero del orden es el primero en salir entre los de igual clave.
+        UnitHeap(int totalNodes, const int *order)
+        {
+            key = new int[totalNodes + 1];
+            previous = new int[totalNodes + 1];
+            next = new int[totalNodes + 1];
+            contained = new bool[totalNodes + 1];
+            headCapacity = 16;
+            head = new int[headCapacity];
+            for (int k = 0; k < headCapacity; k++)
+            {
+                head[k] = 0;
+            }
+            maxKey = 0;
+            for (int i = totalNodes - 1; i >= 0; i--)
+            {
+                key[order[i]] = 0;
+                contained[order[i]] = true;
+                link(order[i]);
+            }
+        }
+
+        ~UnitHeap()
+        {
+            delete[] key;
+            delete[] previous;
+            delete[] next;
+            delete[] contained;
+            delete[] head;
+        }
+
+        /// @brief Agrega el nodo al principio de la lista de su clave.
+        void link(int node)
+        {
+            if (key[node] >= headCapacity)
+            {
+                int *newHead = new int[2 * headCapacity];
+                for (int k = 0; k < 2 * headCapacity; k++)
+                {
+                    newHead[k] = k < headCapacity ? head[k] : 0;
+                }
+                delete[] head;
+                head = newHead;
+                headCapacity *= 2;
+            }
+            previous[node] = 0;
+            next[node] = head[key[node]];
+            if (head[key[node]] != 0)
+            {
+                previous[head[key[node]]] = node;
+            }
+            head[key[node]] = node;
+            maxKey = key[node] > maxKey ? key[node] : maxKey;
+        }
+
+        void unlink(int node)
+        {
+            if (previous[node] != 0)
+            {
+                next[previous[node]] = next[node];
+            }
+            else
+            {
+                head[key[node]] = next[node];
+            }
+            if (next[node] != 0)
+            {
+                previous[next[node]] = previous[node];
+            }
+        }
+
+        void add(int node, int delta)
+        {
+            if (contained[node])
+            {
+                unlink(node);
+                key[node] += delta;
+                link(node);
+            }
+        }
+
+        void remove(int node)
+        {
+            unlink(node);
+            contained[node] = false;
+        }
+
+        /// @brief Quita y retorna un nodo de clave máxima.
+        /// Precondición: la cola no está vacía.
+        int pop()
+        {
+            // Las claves sólo bajan de a uno, así que la máxima se busca perezosamente hacia abajo.
+            while (head[maxKey] == 0)
+            {
+                maxKey--;
+            }
+            int node = head[maxKey];
+            remove(node);
+            return node;
+        }
+    };
+
+    explicit Reordering(int totalNodes)
+    {
+        _totalNodes = totalNodes;
+        _newId = new int[totalNodes + 1];
+        _originalId = new int[totalNodes + 1];
+        _newId[0] = 0;
+        _originalId[0] = 0;
+    }
+
+    /// @brief Completa la permutación a partir de los nodos originales en su nuevo orden.
+    void setOrder(const int *order, bool isReversed)
+    {
+        for (int i = 0; i < _totalNodes; i++)
+        {
+            int newId = isReversed ? _totalNodes - i : i + 1;
+            _newId[order[i]] = newId;
+            _originalId[newId] = order[i];
+        }
+    }
+
+    /// @brief Retorna el grado de cada nodo, contando las aristas de entrada si el grafo es dirigido.
+    static int *degrees(const CSRGraph &graph, const CSRGraph *reverse)
+    {
+        int *degree = new int[graph.totalNodes() + 1];
+        for (int u = 1; u <= graph.totalNodes(); u++)
+        {
+            degree[u] = graph.outDegree(u) + (reverse != NULL ? reverse->outDegree(u) : 0);
+        }
+        return degree;
+    }
+
+    /// @brief Retorna los nodos ordenados por grado de mayor a menor con un counting sort estable.
+    static int *sortByDegree(const int *degree, int totalNodes)
+    {
+        int maxDegree = 0;
+        for (int u = 1; u <= totalNodes; u++)
+        {
+            maxDegree = degree[u] > maxDegree ? degree[u] : maxDegree;
+        }
+        int *count = new int[maxDegree + 2];
+        for (int d = 0; d <= maxDegree + 1; d++)
+        {
+            count[d] = 0;
+        }
+        for (int u = 1; u <= totalNodes; u++)
+        {
+            count[maxDegree - degree[u] + 1]++;
+        }
+        for (int d = 1; d <= maxDegree + 1; d++)
+        {
+            count[d] += count[d - 1];
+        }
+        int *order = new int[totalNodes > 0 ? totalNodes : 1];
+        for (int u = 1; u <= totalNodes; u++)
+        {
+            order[count[maxDegree - degree[u]]++] = u;
+        }
+        delete[] count;
+        return order;
+    }
+
+    /// @brief Ordena nodes[begin, end) por grado de menor a mayor con un merge sort estable.
+    static void sortRangeByDegree(int *nodes, int begin, int end, const int *degree, int *scratch)
+    {
+        for (int width = 1; width < end - begin; width *= 2)
+        {
+            for (int left = begin; left < end; left += 2 * width)
+            {
+                int middle = left + width < end ? left + width : end;
+                int right = middle + width < end ? middle + width : end;
+                int i = left;
+                int j = middle;
+                int k = left;
+                while (i < middle || j < right)
+                {
+                    bool takeLeft = j == right || (i < middle && degree[nodes[i]] <= degree[nodes[j]]);
+                    scratch[k++] = takeLeft ? nodes[i++] : nodes[j++];
+                }
+            }
+            for (int i = begin; i < end; i++)
+            {
+                nodes[i] = scratch[i];
+            }
+        }
+    }
+
+    /// @brief Recorre por anchura la componente de start y deja en queue los nodos visitados, por niveles.
+    /// Si sortNeighbors es true, los vecinos nuevos de cada nodo se encolan de menor a mayor grado.
+    /// @return La cantidad de nodos visitados. En levelStart queda el índice de cola donde comienza el último nivel.
+    static int breadthFirst(const CSRGraph &graph, const CSRGraph *reverse, int start, const int *degree, bool sortNeighbors,
+                            int *queue, int *visitedStamp, int stamp, int *scratch, int &levelStart, int &levels)
+    {
+        int head = 0;
+        int tail = 0;
+        queue[tail++] = start;
+        visitedStamp[start] = stamp;
+        levelStart = 0;
+        levels = 1;
+        int levelEnd = 1;
+        while (head < tail)
+        {
+            if (head == levelEnd)
+            {
+                levelStart = head;
+                levelEnd = tail;
+                levels++;
+            }
+            int node = queue[head++];
+            int firstNew = tail;
+            for (int side = 0; side < 2; side++)
+            {
+                const CSRGraph *adjacency = side == 0 ? &graph : reverse;
+                if (adjacency == NULL)
+                {
+                    continue;
+                }
+                for (int e = adjacency->edgesBegin(node); e < adjacency->edgesEnd(node); e++)
+                {
+                    int adjacentNode = adjacency->target(e);
+                    if (visitedStamp[adjacentNode] != stamp)
+                    {
+                        visitedStamp[adjacentNode] = stamp;
+                        queue[tail++] = adjacentNode;
+                    }
+                }
+            }
+            if (sortNeighbors)
+            {
+                sortRangeByDegree(queue, firstNew, tail, degree, scratch);
+            }
+        }
+        return tail;
+    }
+
+    /// @brief Cuthill-McKee inverso. Cada componente se recorre desde un nodo pseudo-periférico, que se busca
+    /// como George y Liu: se recorre desde el nodo de menor grado y se pasa al de menor grado del último
+    /// nivel mientras la cantidad de niveles crezca.
+    void reverseCuthillMcKee(const CSRGraph &graph, const CSRGraph *reverse)
+    {
+        int *degree = degrees(graph, reverse);
+        int *byDegree = sortByDegree(degree, _totalNodes);
+        int *order = new int[_totalNodes + 1];
+        int *queue = new int[_totalNodes + 1];
+        int *scratch = new int[_totalNodes + 1];
+        int *visitedStamp = new int[_totalNodes + 1];
+        bool *isPlaced = new bool[_totalNodes + 1];
+        for (int u = 0; u <= _totalNodes; u++)
+        {
+            visitedStamp[u] = 0;
+            isPlaced[u] = false;
+        }
+        int stamp = 0;
+        int placed = 0;
+        // byDegree va de mayor a menor grado, así que se recorre desde el final.
+        for (int i = _totalNodes - 1; i >= 0; i--)
+        {
+            int start = byDegree[i];
+            if (isPlaced[start])
+            {
+                continue;
+            }
+            int levelStart;
+            int levels;
+            int visited = breadthFirst(graph, reverse, start, degree, false, queue, visitedStamp, ++stamp, scratch, levelStart, levels);
+            while (true)
+            {
+                int candidate = queue[levelStart];
+                for (int q = levelStart + 1; q < visited; q++)
+                {
+                    candidate = degree[queue[q]] < degree[candidate] ? queue[q] : candidate;
+                }
+                int candidateLevelStart;
+                int candidateLevels;
+                breadthFirst(graph, reverse, candidate, degree, false, queue, visitedStamp, ++stamp, scratch, candidateLevelStart, candidateLevels);
+                if (candidateLevels <= levels)
+                {
+                    break;
+                }
+                start = candidate;
+                levelStart = candidateLevelStart;
+                levels = candidateLevels;
+            }
+            visited = breadthFirst(graph, reverse, start, degree, true, queue, visitedStamp, ++stamp, scratch, levelStart, levels);
+            for (int q = 0; q < visited; q++)
+            {
+                order[placed++] = queue[q];
+                isPlaced[queue[q]] = true;
+            }
+        }
+        setOrder(order, true);
+        delete[] degree;
+        delete[] byDegree;
+        delete[] order;
+        delete[] queue;
+        delete[] scratch;
+        delete[] visitedStamp;
+        delete[] isPlaced;
+    }
+
+    /// @brief Suma delta a la relación de los nodos sin numerar con node: sus vecinos, y los nodos con los que
+    /// comparte un vecino de entrada.
+    static void updateWindowScores(const CSRGraph &graph, const CSRGraph &reverse, UnitHeap &heap, int node, int delta)
+    {
+        for (int e = graph.edgesBegin(node); e < graph.edgesEnd(node); e++)
+        {
+            heap.add(graph.target(e), delta);
+        }
+        for (int e = reverse.edgesBegin(node); e < reverse.edgesEnd(node); e++)
+        {
+            int inNeighbor = reverse.target(e);
+            heap.add(inNeighbor, delta);
+            if (graph.outDegree(inNeighbor) <= HUB_DEGREE)
+            {
+                for (int f = graph.edgesBegin(inNeighbor); f < graph.edgesEnd(inNeighbor); f++)
+                {
+                    heap.add(graph.target(f), delta);
+                }
+            }
+        }
+    }
+
+    /// @brief Numera los nodos con la heurística de Gorder: el próximo nodo es el que maximiza su relación con
+    /// los últimos window nodos numerados. Comienza por el nodo de mayor grado, que también es el elegido cuando
+    /// ningún nodo sin numerar está relacionado con la ventana.
+    void windowLocality(const CSRGraph &graph, const CSRGraph &reverse, int window)
+    {
+        int *degree = degrees(graph, &reverse);
+        int *byDegree = sortByDegree(degree, _totalNodes);
+        int *order = new int[_totalNodes + 1];
+        UnitHeap heap(_totalNodes, byDegree);
+        for (int i = 0; i < _totalNodes; i++)
+        {
+            if (i > window)
+            {
+                updateWindowScores(graph, reverse, heap, order[i - window - 1], -1);
+            }
+            order[i] = heap.pop();
+            updateWindowScores(graph, reverse, heap, order[i], 1);
+        }
+        setOrder(order, false);
+        delete[] degree;
+        delete[] byDegree;
+        delete[] order;
+    }
+
+public:
+    ~Reordering()
+    {
+        delete[] _newId;
+        delete[] _originalId;
+    }
+
+    /// @brief Calcula la permutación de los nodos del grafo según el criterio dado.
+    /// Si el grafo es dirigido, se consideran las aristas en ambos sentidos.
+    /// @param window Cantidad de nodos recientes que compara WINDOW_LOCALITY. Si es menor a 1, se usa 5.
+    static Reordering *compute(const CSRGraph &graph, ReorderingType type, int window = 0)
+    {
+        Reordering *reordering = new Reordering(graph.totalNodes());
+        CSRGraph *reverse = graph.isDirected() ? graph.transpose() : NULL;
+        if (type == REVERSE_CUTHILL_MCKEE)
+        {
+            reordering->reverseCuthillMcKee(graph, reverse);
+        }
+        else if (type == DEGREE_DESCENDING)
+        {
+            int *degree = degrees(graph, reverse);
+            int *order = sortByDegree(degree, graph.totalNodes());
+            reordering->setOrder(order, false);
+            delete[] degree;
+            delete[] order;
+        }
+        else
+        {
+            reordering->windowLocality(graph, reverse != NULL ? *reverse : graph, window > 0 ? window : DEFAULT_WINDOW);
+        }
+        delete reverse;
+        return reordering;
+    }
+
+    int totalNodes() const
+    {
+        return _totalNodes;
+    }
+
+    /// @brief Retorna el número del nodo original en el grafo renumerado.
+    int newId(int node) const
+    {
+        return _newId[node];
+    }
+
+    /// @brief Retorna el número original del nodo del grafo renumerado.
+    int originalId(int node) const
+    {
+        return _originalId[node];
+    }
+
+    /// @brief Retorna el grafo con los nodos renumerados. Las aristas de cada nodo conservan su orden.
+    /// @param threads Cantidad de hilos para construirlo.
+    CSRGraph *apply(const CSRGraph &graph, int threads = 1) const
+    {
+        assert(graph.totalNodes() == _totalNodes);
+        int totalEdges = graph.totalEdges();
+        int *from = new int[totalEdges > 0 ? totalEdges : 1];
+        int *to = new int[totalEdges > 0 ? totalEdges : 1];
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            for (int e = graph.edgesBegin(u); e < graph.edgesEnd(u); e++)
+            {
+                from[e] = _newId[u];
+                to[e] = _newId[graph.target(e)];
+            }
+        }
+        CSRGraph *result = new CSRGraph(_totalNodes, totalEdges, from, to, graph.weights(), graph.isDirected(), threads);
+        delete[] from;
+        delete[] to;
+        return result;
+    }
+
+    /// @brief Traduce un resultado por nodo del grafo renumerado, como las distancias, a la numeración original:
+    /// result[u] = values[newId(u)].
+    template <class T>
+    void toOriginal(const T *values, T *result) const
+    {
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            result[u] = values[_newId[u]];
+        }
+    }
+
+    /// @brief Igual que toOriginal para resultados cuyos valores también son nodos, como los predecesores.
+    /// El valor 0, que indica que no hay nodo, se conserva.
+    void nodesToOriginal(const int *nodes, int *result) const
+    {
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            result[u] = _originalId[nodes[_newId[u]]];
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic> // Para repartir los rangos de iteraciones entre los hilos.
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/// @brief Implementa un conjunto fijo de hilos que ejecutan ciclos paralelos.
+/// Los hilos se crean una única vez y esperan entre un ciclo y el siguiente, por lo que
+/// conviene para algoritmos que ejecutan muchos ciclos paralelos cortos, como los recorridos por niveles.
+/// El hilo que llama a parallelFor también trabaja, y cuenta como uno de los hilos.
+/// @note No admite llamadas a parallelFor concurrentes ni anidadas.
+class ThreadPool
+{
+private:
+    int _threads;
+    std::thread *_workers;
+    std::mutex _mutex;
+    std::condition_variable _wakeCondition;
+    std::condition_variable _doneCondition;
+    int _generation;
+    int _pending;
+    bool _stop;
+
+    /// @brief El ciclo actual: una función sin tipo sobre un contexto, para no solicitar memoria por ciclo.
+    void (*_jobFunction)(void *, int, int, int);
+    void *_jobContext;
+    std::atomic<int> _nextIndex;
+    int _endIndex;
+    int _grain;
+
+    template <class F>
+    static void invoke(void *context, int begin, int end, int worker)
+    {
+        (*static_cast<F *>(context))(begin, end, worker);
+    }
+
+    void runJob(int worker)
+    {
+        int begin;
+        while ((begin = _nextIndex.fetch_add(_grain, std::memory_order_relaxed)) < _endIndex)
+        {
+            int end = _endIndex - begin > _grain ? begin + _grain : _endIndex;
+            _jobFunction(_jobContext, begin, end, worker);
+        }
+    }
+
+    void workerLoop(int worker)
+    {
+        int seenGeneration = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                while (!_stop && _generation == seenGeneration)
+                {
+                    _wakeCondition.wait(lock);
+                }
+                if (_stop)
+                {
+                    return;
+                }
+                seenGeneration = _generation;
+            }
+            runJob(worker);
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (--_pending == 0)
+            {
+                _doneCondition.notify_one();
+            }
+        }
+    }
+
+public:
+    /// @brief Crea el conjunto de hilos.
+    /// @param threads Cantidad total de hilos, incluido el que llama. Si es menor a 1, se usa la cantidad de núcleos.
+    explicit ThreadPool(int threads)
+    {
+        _threads = threads > 0 ? threads : hardwareThreads();
+        _generation = 0;
+        _pending = 0;
+        _stop = false;
+        _workers = new std::thread[_threads - 1];
+        for (int i = 1; i < _threads; i++)
+        {
+            _workers[i - 1] = std::thread(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _wakeCondition.notify_all();
+        for (int i = 0; i < _threads - 1; i++)
+        {
+            _workers[i].join();
+        }
+        delete[] _workers;
+    }
+
+    /// @brief Retorna la cantidad de núcleos disponibles, o 1 si no se puede determinar.
+    static int hardwareThreads()
+    {
+        int threads = (int)std::thread::hardware_concurrency();
+        return threads > 0 ? threads : 1;
+    }
+
+    int size() const
+    {
+        return _threads;
+    }
+
+    /// @brief Ejecuta body(rangeBegin, rangeEnd, worker) sobre rangos consecutivos que cubren [begin, end),
+    /// repartidos dinámicamente entre los hilos. Retorna cuando todos los rangos terminaron.
+    /// @param body Función que recibe un rango [rangeBegin, rangeEnd) y el número de hilo, de 0 a size() - 1.
+    /// @param grain Tamaño de cada rango. Si es menor a 1, se elige según la cantidad de hilos.
+    template <class F>
+    void parallelFor(int begin, int end, F body, int grain = 0)
+    {
+        if (end <= begin)
+        {
+            return;
+        }
+        if (grain < 1)
+        {
+            grain = (end - begin) / (_threads * 8);
+            grain = grain > 0 ? grain : 1;
+        }
+        if (_threads == 1 || end - begin <= grain)
+        {
+            body(begin, end, 0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _jobFunction = &invoke<F>;
+            _jobContext = &body;
+            _nextIndex.store(begin, std::memory_order_relaxed);
+            _endIndex = end;
+            _grain = grain;
+            _pending = _threads - 1;
+            _generation++;
+        }
+        _wakeCondition.notify_all();
+        runJob(0);
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (_pending > 0)
+        {
+            _doneCondition.wait(lock);
+        }
+    }
+};
+
+#endif
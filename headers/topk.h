@@ -0,0 +1,102 @@
+#ifndef TOPK_H
+#define TOPK_H
+
+#include "heap.h"
+#include "list.h"
+
+/// @brief Conserva los k mejores elementos de un flujo de tipo T de largo arbitrario,
+/// en O(log k) por elemento y O(k) de memoria.
+/// @tparam Comparator Retorna true si el primer elemento es mejor que el segundo.
+/// Con MinComparator se conservan los k menores, con MaxComparator los k mayores.
+template <class T, class Comparator = MinComparator<T>, int Arity = 2>
+class TopK
+{
+private:
+    /// @brief Invierte el comparador, para que el tope del heap sea el peor elemento conservado.
+    class WorstFirst
+    {
+    private:
+        Comparator _comparator;
+
+    public:
+        WorstFirst() {}
+        explicit WorstFirst(Comparator comparator) : _comparator(comparator) {}
+
+        bool operator()(const T &a, const T &b) const
+        {
+            return _comparator(b, a);
+        }
+    };
+
+    int _k;
+    Comparator _comparator;
+    Heap<T, WorstFirst, Arity> *_heap;
+
+public:
+    /// @brief Crea un top-k vacío.
+    /// @param k Cantidad de elementos a conservar. Precondición: k > 0.
+    explicit TopK(int k, Comparator comparator = Comparator()) : _k(k), _comparator(comparator)
+    {
+        assert(k > 0);
+        _heap = new Heap<T, WorstFirst, Arity>(k, WorstFirst(comparator));
+    }
+
+    ~TopK()
+    {
+        delete _heap;
+    }
+
+    /// @brief Ofrece un elemento del flujo. Si ya hay k elementos y es mejor que el peor
+    /// de ellos, lo sustituye con replaceTop. Retorna true si el elemento quedó conservado.
+    bool offer(T element)
+    {
+        if (_heap->size() < _k)
+        {
+            return _heap->add(element);
+        }
+        if (_comparator(element, _heap->top()))
+        {
+            return _heap->replaceTop(element);
+        }
+        return false;
+    }
+
+    /// @brief Retorna el peor de los elementos conservados, que es el umbral para entrar.
+    /// Precondición: no es vacío.
+    T worst() const
+    {
+        assert(!isEmpty());
+        return _heap->top();
+    }
+
+    int size() const
+    {
+        return _heap->size();
+    }
+
+    bool isEmpty() const
+    {
+        return _heap->isEmpty();
+    }
+
+    bool isFull() const
+    {
+        return _heap->size() == _k;
+    }
+
+    /// @brief Retorna una lista con los elementos conservados, del mejor al peor.
+    List<T> *toList() const
+    {
+        Heap<T, WorstFirst, Arity> sortedHeap(_heap->getArray() + 1, _heap->size(), WorstFirst(_comparator));
+        int count = sortedHeap.heapSort();
+        List<T> *list = new List<T>();
+        T *sortedElements = sortedHeap.getArray();
+        for (int i = 1; i <= count; i++)
+        {
+            list->add(sortedElements[i]);
+        }
+        return list;
+    }
+};
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef UNIONFIND_H
+#define UNIONFIND_H
+
+/// @brief Implementa una partición de los elementos 1 a size en conjuntos disjuntos (union-find).
+/// Cada conjunto es un árbol representado por su raíz. La unión por rango cuelga el árbol más bajo
+/// del más alto y find comprime el camino recorrido, por lo que cada operación cuesta en la práctica O(1).
+/// @note Como en el resto de las estructuras, no se utiliza el índice 0.
+class UnionFind
+{
+private:
+    int _size;
+    int _sets;
+    int *_parent;
+    /// @brief Cota superior de la altura del árbol de cada raíz.
+    int *_rank;
+
+public:
+    /// @brief Crea la partición con cada elemento en su propio conjunto.
+    explicit UnionFind(int size)
+    {
+        _size = size;
+        _sets = size;
+        _parent = new int[_size + 1];
+        _rank = new int[_size + 1];
+        for (int i = 0; i <= _size; i++)
+        {
+            _parent[i] = i;
+            _rank[i] = 0;
+        }
+    }
+
+    ~UnionFind()
+    {
+        delete[] _parent;
+        delete[] _rank;
+    }
+
+    /// @brief Retorna el representante del conjunto del elemento, y cuelga directamente de él
+    /// a todos los elementos del camino.
+    int find(int element)
+    {
+        assert(element > 0 && element <= _size);
+        int root = element;
+        while (_parent[root] != root)
+        {
+            root = _parent[root];
+        }
+        while (_parent[element] != root)
+        {
+            int next = _parent[element];
+            _parent[element] = root;
+            element = next;
+        }
+        return root;
+    }
+
+    /// @brief Une los conjuntos de ambos elementos. Retorna false si ya estaban en el mismo conjunto.
+    bool unite(int first, int second)
+    {
+        int firstRoot = find(first);
+        int secondRoot = find(second);
+        if (firstRoot == secondRoot)
+        {
+            return false;
+        }
+        if (_rank[firstRoot] < _rank[secondRoot])
+        {
+            _parent[firstRoot] = secondRoot;
+        }
+        else if (_rank[firstRoot] > _rank[secondRoot])
+        {
+            _parent[secondRoot] = firstRoot;
+        }
+        else
+        {
+            _parent[secondRoot] = firstRoot;
+            _rank[firstRoot]++;
+        }
+        _sets--;
+        return true;
+    }
+
+    /// @brief Retorna true si ambos elementos están en el mismo conjunto.
+    bool connected(int first, int second)
+    {
+        return find(first) == find(second);
+    }
+
+    /// @brief Retorna la cantidad de conjuntos.
+    int sets() const
+    {
+        return _sets;
+    }
+
+    int size() const
+    {
+        return _size;
+    }
+};
+
+#endif
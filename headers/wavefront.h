@@ -0,0 +1,247 @@
+#ifndef WAVEFRONT_H
+#define WAVEFRONT_H
+
+#include <atomic> // Para bajar los grados de entrada y alargar los caminos desde varios hilos.
+
+#include "csrgraph.h"
+#include "stack.h"
+#include "threadpool.h"
+
+/// @brief Implementa el orden topológico por niveles (frentes de onda) de un grafo dirigido acíclico.
+/// El nivel 0 son los nodos sin aristas de entrada, y el nivel de cada nodo es uno más que el mayor nivel de
+/// los nodos que lo apuntan, por lo que los nodos de un mismo nivel se pueden procesar en paralelo.
+/// Cada nivel se procesa entre todos los hilos: al recorrer las aristas de un nodo se baja atómicamente el
+/// grado de entrada de sus adyacentes, y el hilo que lo deja en 0 agrega el adyacente al nivel siguiente.
+/// En la misma pasada se calcula el camino más largo (camino crítico) que termina en cada nodo.
+/// @note El orden de los nodos dentro de cada nivel no está definido.
+class Wavefront
+{
+private:
+    /// @brief Cantidad de nodos que cada hilo acumula antes de reservar lugar en el próximo nivel.
+    static const int BUFFER_SIZE = 256;
+
+    const CSRGraph &_graph;
+    ThreadPool _pool;
+    int _totalNodes;
+    std::atomic<int> *_inDegree;
+    /// @brief Largo del camino más largo que termina en cada nodo en los 32 bits altos, y el nodo anterior del
+    /// camino en los bajos, para elegir el máximo con una sola operación.
+    std::atomic<long long> *_path;
+    /// @brief Los nodos agrupados por nivel: el nivel l ocupa [_levelBegin[l], _levelBegin[l + 1]).
+    int *_order;
+    std::atomic<int> _orderSize;
+    int *_levelBegin;
+    int _totalLevels;
+    int *_level;
+
+    static long long pack(int length, int previous)
+    {
+        return (long long)length * (1LL << 32) + previous;
+    }
+
+    static int lengthOf(long long path)
+    {
+        return (int)((path - (path & 0xFFFFFFFFLL)) / (1LL << 32));
+    }
+
+    static int previousOf(long long path)
+    {
+        return (int)(path & 0xFFFFFFFFLL);
+    }
+
+    /// @brief Se queda con el mayor de los caminos, o en caso de empate con el de mayor nodo anterior.
+    static void relaxMax(std::atomic<long long> &target, long long candidate)
+    {
+        long long current = target.load(std::memory_order_relaxed);
+        while (candidate > current && !target.compare_exchange_weak(current, candidate, std::memory_order_relaxed));
+    }
+
+    void flush(const int *buffer, int count)
+    {
+        int position = _orderSize.fetch_add(count, std::memory_order_relaxed);
+        for (int i = 0; i < count; i++)
+        {
+            _order[position + i] = buffer[i];
+        }
+    }
+
+public:
+    /// @brief Prepara el cálculo sobre el grafo.
+    /// @param threads Cantidad de hilos. Si es menor a 1, se usa la cantidad de núcleos.
+    explicit Wavefront(const CSRGraph &graph, int threads) : _graph(graph), _pool(threads)
+    {
+        _totalNodes = graph.totalNodes();
+        _inDegree = new std::atomic<int>[_totalNodes + 1];
+        _path = new std::atomic<long long>[_totalNodes + 1];
+        _order = new int[_totalNodes > 0 ? _totalNodes : 1];
+        _levelBegin = new int[_totalNodes + 2];
+        _level = new int[_totalNodes + 1];
+        _totalLevels = 0;
+    }
+
+    ~Wavefront()
+    {
+        delete[] _inDegree;
+        delete[] _path;
+        delete[] _order;
+        delete[] _levelBegin;
+        delete[] _level;
+    }
+
+    /// @brief Calcula los niveles y los caminos más largos.
+    /// @return false si el grafo no es dirigido o tiene un ciclo. En ese caso, los niveles sólo contienen
+    /// los nodos que no dependen de un ciclo.
+    bool compute()
+    {
+        _pool.parallelFor(0, _totalNodes + 1, [&](int begin, int end, int)
+        {
+            for (int u = begin; u < end; u++)
+            {
+                _inDegree[u].store(0, std::memory_order_relaxed);
+                _path[u].store(0, std::memory_order_relaxed);
+                _level[u] = -1;
+            }
+        });
+        _pool.parallelFor(1, _totalNodes + 1, [&](int begin, int end, int)
+        {
+            for (int u = begin; u < end; u++)
+            {
+                for (int e = _graph.edgesBegin(u); e < _graph.edgesEnd(u); e++)
+                {
+                    _inDegree[_graph.target(e)].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+        _orderSize.store(0, std::memory_order_relaxed);
+        _pool.parallelFor(1, _totalNodes + 1, [&](int begin, int end, int)
+        {
+            int buffer[BUFFER_SIZE];
+            int count = 0;
+            for (int u = begin; u < end; u++)
+            {
+                if (_inDegree[u].load(std::memory_order_relaxed) == 0)
+                {
+                    buffer[count++] = u;
+                    if (count == BUFFER_SIZE)
+                    {
+                        flush(buffer, count);
+                        count = 0;
+                    }
+                }
+            }
+            flush(buffer, count);
+        });
+
+        _totalLevels = 0;
+        _levelBegin[0] = 0;
+        int levelEnd = _orderSize.load(std::memory_order_relaxed);
+        while (_levelBegin[_totalLevels] < levelEnd)
+        {
+            int level = _totalLevels;
+            int begin = _levelBegin[level];
+            // Los caminos de los nodos del nivel ya son definitivos, porque todos los nodos que los apuntan
+            // están en niveles anteriores y la barrera de parallelFor separa un nivel del siguiente.
+            _pool.parallelFor(begin, levelEnd, [&](int rangeBegin, int rangeEnd, int)
+            {
+                int buffer[BUFFER_SIZE];
+                int count = 0;
+                for (int i = rangeBegin; i < rangeEnd; i++)
+                {
+                    int node = _order[i];
+                    _level[node] = level;
+                    int length = lengthOf(_path[node].load(std::memory_order_relaxed));
+                    for (int e = _graph.edgesBegin(node); e < _graph.edgesEnd(node); e++)
+                    {
+                        int adjacentNode = _graph.target(e);
+                        relaxMax(_path[adjacentNode], pack(length + _graph.weight(e), node));
+                        if (_inDegree[adjacentNode].fetch_sub(1, std::memory_order_relaxed) == 1)
+                        {
+                            buffer[count++] = adjacentNode;
+                            if (count == BUFFER_SIZE)
+                            {
+                                flush(buffer, count);
+                                count = 0;
+                            }
+                        }
+                    }
+                }
+                flush(buffer, count);
+            }, 64);
+            _totalLevels++;
+            _levelBegin[_totalLevels] = levelEnd;
+            levelEnd = _orderSize.load(std::memory_order_relaxed);
+        }
+        return _graph.isDirected() && levelEnd == _totalNodes;
+    }
+
+    /// @brief Retorna la cantidad de niveles.
+    int totalLevels() const
+    {
+        return _totalLevels;
+    }
+
+    /// @brief Retorna los nodos del nivel dado, que son levelSize(level) posiciones consecutivas.
+    const int *levelNodes(int level) const
+    {
+        return _order + _levelBegin[level];
+    }
+
+    int levelSize(int level) const
+    {
+        return _levelBegin[level + 1] - _levelBegin[level];
+    }
+
+    /// @brief Retorna el nivel del nodo, o -1 si depende de un ciclo.
+    int level(int node) const
+    {
+        return _level[node];
+    }
+
+    /// @brief Retorna los nodos en orden topológico: primero todos los del nivel 0, luego los del 1, etc.
+    const int *order() const
+    {
+        return _order;
+    }
+
+    /// @brief Retorna el peso del camino más largo que termina en el nodo, o 0 si ninguno pesa más que 0.
+    /// Precondición: los pesos de los caminos entran en un int.
+    int longestPathTo(int node) const
+    {
+        return lengthOf(_path[node].load(std::memory_order_relaxed));
+    }
+
+    /// @brief Retorna el peso del camino más largo del grafo, o 0 si ninguno pesa más que 0.
+    int criticalPathLength() const
+    {
+        int length = 0;
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            length = longestPathTo(u) > length ? longestPathTo(u) : length;
+        }
+        return length;
+    }
+
+    /// @brief Retorna un stack con el camino más largo del grafo, comenzando desde el origen.
+    /// Si todas las aristas pesan 0 o menos, el camino es un único nodo.
+    Stack<int> *criticalPath() const
+    {
+        Stack<int> *path = new Stack<int>();
+        int last = 0;
+        for (int u = 1; u <= _totalNodes; u++)
+        {
+            last = last == 0 || longestPathTo(u) > longestPathTo(last) ? u : last;
+        }
+        for (int node = last; node != 0; node = previousOf(_path[node].load(std::memory_order_relaxed)))
+        {
+            path->push(node);
+            // Un camino de peso 0 o menor no mejora empezar en el nodo, así que el camino termina acá.
+            if (longestPathTo(node) <= 0)
+            {
+                break;
+            }
+        }
+        return path;
+    }
+};
+
+#endif